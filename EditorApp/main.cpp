@@ -15,8 +15,10 @@
 #include "ramses_adaptor/SceneBackend.h"
 #include "utils/CrashDump.h"
 #include "components/DataChangeDispatcher.h"
+#include "components/MeshCacheImpl.h"
 #include "application/RaCoApplication.h"
 #include "components/RaCoNameConstants.h"
+#include "core/CoreFormatter.h"
 #include "style/RaCoStyle.h"
 
 #include <QApplication>
@@ -128,9 +130,13 @@ int main(int argc, char *argv[]) {
 
 	auto ramsesCommandLineArgs = parser.value(forwardCommandLineArgs).toStdString();
 	raco::ramses_widgets::RendererBackend rendererBackend{parser.isSet(forwardCommandLineArgs) ? ramsesCommandLineArgs : ""};
-	raco::application::RaCoApplication app{rendererBackend, projectFile};
+	rendererBackend.shaderInterfaceCache().setCacheFile(raco::core::PathManager::shaderCacheFilePath());
+	raco::components::MeshCacheImpl::setDiskCacheDirectory(raco::core::PathManager::meshCacheDirectory());
+	raco::application::RaCoApplication app{rendererBackend, projectFile, true};
 
 	MainWindow w{&app, &rendererBackend};
 	w.show();
-	return a.exec();
+	auto exitCode = a.exec();
+	LOG_INFO(raco::log_system::COMMON, "Mesh cache: {}", app.meshCache()->statistics());
+	return exitCode;
 }
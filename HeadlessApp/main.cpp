@@ -13,8 +13,10 @@
 #include "ramses_base/HeadlessEngineBackend.h"
 #include "utils/CrashDump.h"
 #include "components/DataChangeDispatcher.h"
+#include "components/MeshCacheImpl.h"
 #include "application/RaCoApplication.h"
 #include "components/RaCoNameConstants.h"
+#include "core/CoreFormatter.h"
 
 #include <QCoreApplication>
 #include <QTimer>
@@ -31,9 +33,13 @@ public:
 public Q_SLOTS:
 	void run() {
 		raco::ramses_base::HeadlessEngineBackend backend{};
-		raco::application::RaCoApplication app{backend, projectFile_};
+		backend.shaderInterfaceCache().setCacheFile(raco::core::PathManager::shaderCacheFilePath());
+		raco::components::MeshCacheImpl::setDiskCacheDirectory(raco::core::PathManager::meshCacheDirectory());
+		raco::application::RaCoApplication app{backend, projectFile_, true};
 
 		if ( !exportPath_.isEmpty() ) {
+			app.finishPendingMeshLoads();
+
 			QString ramsesPath = exportPath_ + "." + raco::names::FILE_EXTENSION_RAMSES_EXPORT;
 			QString logicPath = exportPath_ + "." + raco::names::FILE_EXTENSION_LOGIC_EXPORT;
 
@@ -42,6 +48,7 @@ public Q_SLOTS:
 				LOG_ERROR(raco::log_system::COMMON, "error exporting to {}\n{}", error.c_str(), ramsesPath.toStdString());
 			}
 		}
+		LOG_INFO(raco::log_system::COMMON, "Mesh cache: {}", app.meshCache()->statistics());
 
 		Q_EMIT finished();
 	}
@@ -0,0 +1,71 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <gtest/gtest.h>
+
+#include "mesh_loader/MeshOptimizer.h"
+#include "mesh_loader/glTFFileLoader.h"
+#include "testing/RacoBaseTest.h"
+
+#include <QByteArray>
+
+#include <iostream>
+
+using namespace raco;
+
+class MeshOptimizerBenchmark : public RacoBaseTest<> {
+protected:
+	core::SharedMeshData load(const std::string& relativePath, bool optimize, int lodLevel = 0, bool quantize = false) {
+		core::MeshDescriptor desc;
+		desc.absPath = cwd_path().append(relativePath).string();
+		desc.optimizeMesh = optimize;
+		desc.lodLevel = lodLevel;
+		desc.quantizeAttributes = quantize;
+		mesh_loader::glTFFileLoader fileloader(desc.absPath);
+		return fileloader.loadMesh(desc);
+	}
+
+	static double acmr(const core::MeshData& mesh) {
+		auto indices = mesh.getIndices();
+		return mesh_loader::averageCacheMissRatio(indices.data(), indices.size());
+	}
+};
+
+TEST_F(MeshOptimizerBenchmark, vertex_cache_optimization) {
+	for (auto relativePath : {"meshes/Duck.glb", "meshes/CesiumMilkTruck/CesiumMilkTruck.gltf"}) {
+		auto original = load(relativePath, false);
+		auto optimized = load(relativePath, true);
+		ASSERT_NE(original, nullptr);
+		ASSERT_NE(optimized, nullptr);
+		std::cout << relativePath << ": ACMR " << acmr(*original) << " -> " << acmr(*optimized) << ", vertices " << original->numVertices() << " -> " << optimized->numVertices() << std::endl;
+	}
+}
+
+TEST_F(MeshOptimizerBenchmark, lod_levels) {
+	for (int lodLevel = 1; lodLevel <= 3; lodLevel++) {
+		auto simplified = load("meshes/Duck.glb", false, lodLevel);
+		ASSERT_NE(simplified, nullptr);
+		std::cout << "LOD " << lodLevel << ": " << simplified->numTriangles() << " of " << simplified->numFullDetailTriangles() << " triangles, " << simplified->numVertices() << " vertices" << std::endl;
+	}
+}
+
+TEST_F(MeshOptimizerBenchmark, attribute_quantization) {
+	auto original = load("meshes/CesiumMilkTruck/CesiumMilkTruck.gltf", false);
+	auto quantized = load("meshes/CesiumMilkTruck/CesiumMilkTruck.gltf", false, 0, true);
+	ASSERT_NE(original, nullptr);
+	ASSERT_NE(quantized, nullptr);
+
+	size_t originalCompressed = 0;
+	size_t quantizedCompressed = 0;
+	for (uint32_t i = 0; i < original->numAttributes(); i++) {
+		originalCompressed += qCompress(QByteArray::fromRawData(original->attribBuffer(i), original->attribDataSize(i))).size();
+		quantizedCompressed += qCompress(QByteArray::fromRawData(quantized->attribBuffer(i), quantized->attribDataSize(i))).size();
+	}
+	std::cout << "Compressed attribute data: " << originalCompressed << " -> " << quantizedCompressed << " bytes" << std::endl;
+}
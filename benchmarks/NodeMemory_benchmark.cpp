@@ -0,0 +1,127 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "data_storage/BasicTypes.h"
+#include "user_types/Node.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace raco::data_storage;
+using namespace raco::user_types;
+
+// This executable replaces the global operator new / delete to count the heap usage, so it is kept separate from all
+// other tests and benchmarks. It only links static libraries, so no allocation crosses a shared library boundary.
+// Aligned allocations are not counted: they use the default operators, which don't call the replacements below.
+
+namespace {
+
+std::atomic<long long> liveBytes{0};
+std::atomic<long long> liveAllocations{0};
+
+}  // namespace
+
+// Each allocation is prefixed with its size, so that operator delete can track the live bytes.
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+	auto block = static_cast<std::max_align_t*>(std::malloc(size + sizeof(std::max_align_t)));
+	if (!block) {
+		return nullptr;
+	}
+	*reinterpret_cast<std::size_t*>(block) = size;
+	liveBytes += size;
+	liveAllocations++;
+	return block + 1;
+}
+
+void* operator new(std::size_t size) {
+	if (auto pointer = operator new(size, std::nothrow)) {
+		return pointer;
+	}
+	throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+	return operator new(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+	return operator new(size, std::nothrow);
+}
+
+void operator delete(void* pointer) noexcept {
+	if (pointer) {
+		auto block = static_cast<std::max_align_t*>(pointer) - 1;
+		liveBytes -= *reinterpret_cast<std::size_t*>(block);
+		liveAllocations--;
+		std::free(block);
+	}
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+	operator delete(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+	operator delete(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+	operator delete(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+	operator delete(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+	operator delete(pointer);
+}
+
+TEST(NodeMemoryBenchmark, vector_copy_does_not_allocate) {
+	Node n;
+	auto allocations = liveAllocations.load();
+	{
+		Vec3f copy(*n.rotation_);
+		copy.copyAnnotationData(*n.scale_);
+		EXPECT_EQ(liveAllocations.load(), allocations);
+	}
+	EXPECT_EQ(liveAllocations.load(), allocations);
+}
+
+TEST(NodeMemoryBenchmark, memory_100k_nodes) {
+	constexpr size_t numNodes = 100000;
+	// Create the shared property schemas and annotations before measuring.
+	Node first;
+	std::vector<std::unique_ptr<Node>> nodes;
+	nodes.reserve(numNodes);
+
+	auto bytesBefore = liveBytes.load();
+	auto allocationsBefore = liveAllocations.load();
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < numNodes; i++) {
+		nodes.emplace_back(std::make_unique<Node>());
+	}
+	auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	auto bytes = liveBytes.load() - bytesBefore;
+	auto allocations = liveAllocations.load() - allocationsBefore;
+
+	std::cout << numNodes << " Nodes: " << bytes / (1024.0 * 1024.0) << " MiB in " << allocations << " allocations, created in " << elapsed << " ms" << std::endl;
+	std::cout << "Per Node: " << bytes / numNodes << " bytes, " << allocations / numNodes << " allocations; sizeof(Node) " << sizeof(Node) << ", sizeof(Vec3f) " << sizeof(Vec3f) << std::endl;
+
+	nodes.clear();
+	EXPECT_LE(liveAllocations.load(), allocationsBefore);
+}
@@ -0,0 +1,84 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "data_storage/BasicTypes.h"
+#include "data_storage/Value.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace raco::data_storage;
+
+namespace {
+
+constexpr size_t NUM_WIDE_PROPERTIES = 24;
+
+class Wide : public ClassWithReflectedMembers {
+public:
+	static inline const TypeDescriptor typeDescription = {"Wide", false};
+	TypeDescriptor const& getTypeDescription() const override {
+		return typeDescription;
+	}
+	bool serializationRequired() const override {
+		return false;
+	}
+
+	Wide() {
+		for (size_t i = 0; i < NUM_WIDE_PROPERTIES; i++) {
+			properties_.emplace_back("property" + std::to_string(i), &values_[i]);
+		}
+	}
+
+	std::array<Property<int>, NUM_WIDE_PROPERTIES> values_;
+};
+
+}  // namespace
+
+TEST(ReflectionInterfaceBenchmark, name_lookup) {
+	Wide wide;
+	const std::string lastName = wide.name(NUM_WIDE_PROPERTIES - 1);
+	constexpr int numLookups = 1000000;
+
+	// The linear search over the name/value pairs that each object used to store.
+	std::vector<std::pair<std::string, ValueBase*>> pairs;
+	for (size_t i = 0; i < NUM_WIDE_PROPERTIES; i++) {
+		pairs.emplace_back(wide.name(i), wide.get(i));
+	}
+	auto start = std::chrono::steady_clock::now();
+	size_t found = 0;
+	for (int i = 0; i < numLookups; i++) {
+		auto it = std::find_if(pairs.begin(), pairs.end(), [&lastName](auto const& item) { return item.first == lastName; });
+		found += it != pairs.end() ? 1 : 0;
+	}
+	auto linear = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < numLookups; i++) {
+		found += wide.get(lastName) != nullptr ? 1 : 0;
+	}
+	auto hashed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << numLookups << " lookups of the last of " << NUM_WIDE_PROPERTIES << " properties: linear search " << linear << " ms, schema " << hashed << " ms" << std::endl;
+	EXPECT_EQ(found, 2 * numLookups);
+}
+
+TEST(ReflectionInterfaceBenchmark, construction) {
+	constexpr int numObjects = 100000;
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < numObjects; i++) {
+		Wide wide;
+	}
+	auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	std::cout << numObjects << " objects with " << NUM_WIDE_PROPERTIES << " properties constructed in " << elapsed << " ms" << std::endl;
+}
@@ -0,0 +1,57 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "RamsesBaseFixture.h"
+#include "user_types/MeshNode.h"
+#include "user_types/Node.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+using raco::core::SEditorObject;
+using raco::core::ValueHandle;
+using raco::user_types::MeshNode;
+using raco::user_types::Node;
+
+class SceneAdaptorBenchmark : public RamsesBaseFixture<> {
+protected:
+	static constexpr int numberOfChanges = 200;
+
+	void growProject(size_t numInstances) {
+		while (project.instances().size() < numInstances) {
+			auto parent = context.createObject(Node::typeDescription.typeName, "Parent");
+			auto child = context.createObject(MeshNode::typeDescription.typeName, "Child");
+			context.moveScenegraphChild(child, parent);
+		}
+		dataChangeDispatcher->dispatch(recorder.release());
+	}
+
+	// Average time in microseconds for changing a single property and syncing the change to the engine.
+	double measureSingleChange(SEditorObject object) {
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < numberOfChanges; i++) {
+			context.set(ValueHandle{object, {"translation", "x"}}, static_cast<double>(i));
+			dataChangeDispatcher->dispatch(recorder.release());
+		}
+		auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start);
+		return elapsed.count() / numberOfChanges;
+	}
+};
+
+TEST_F(SceneAdaptorBenchmark, single_change_in_growing_project) {
+	auto node = context.createObject(Node::typeDescription.typeName, "Changed");
+	for (size_t size : {500, 2000, 8000}) {
+		growProject(size);
+		auto time = measureSingleChange(node);
+		std::cout << "SceneAdaptor single change with " << project.instances().size() << " objects: " << time << " us" << std::endl;
+	}
+}
@@ -0,0 +1,96 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "data_storage/BasicAnnotations.h"
+#include "data_storage/Table.h"
+#include "data_storage/Value.h"
+
+#include <chrono>
+#include <iostream>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+using namespace raco::data_storage;
+
+namespace {
+
+// Table with numEntries Double entries and a nested Table.
+Table makeTable(int numEntries) {
+	Table table;
+	for (int i = 0; i < numEntries; i++) {
+		table.addProperty("value" + std::to_string(i), PrimitiveType::Double)->set(static_cast<double>(i));
+	}
+	auto& nested = table.addProperty("nested", PrimitiveType::Table)->asTable();
+	nested.addProperty("value", PrimitiveType::Int);
+	return table;
+}
+
+using ArrayElement = Property<double, RangeAnnotation<double>>;
+
+// Table like the ones holding the elements of Lua arrays: entries named "1", "2", ... of the same Property class.
+Table makeArray(int numElements) {
+	Table table;
+	for (int i = 0; i < numElements; i++) {
+		table.addProperty(std::to_string(i + 1), std::make_unique<ArrayElement>(static_cast<double>(i), RangeAnnotation<double>(0.0, 100.0)));
+	}
+	return table;
+}
+
+}  // namespace
+
+TEST(TableBenchmark, clone_10k_entries) {
+	constexpr int numEntries = 10000;
+	constexpr int numClones = 100;
+	Value<Table> value{makeTable(numEntries)};
+
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < numClones; i++) {
+		auto clone = value.clone(nullptr);
+	}
+	auto shared = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < numClones; i++) {
+		auto clone = value.clone(nullptr);
+		clone->asTable().get(0)->set(-1.0);
+	}
+	auto modified = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << numClones << " clones of a Table with " << numEntries << " entries: " << shared << " ms, modifying each clone " << modified << " ms" << std::endl;
+}
+
+TEST(TableBenchmark, clone_and_update_256_element_array) {
+	constexpr int numElements = 256;
+	constexpr int numIterations = 10000;
+	Table sparse = makeArray(numElements);
+	Table dense = makeArray(numElements);
+	ASSERT_TRUE(dense.makeDense());
+
+	// Modify a copy, e.g. of an undo stack snapshot, and update the original from it like the undo stack does.
+	auto measure = [](Table& table) {
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < numIterations; i++) {
+			Table copy(table);
+			copy.get(i % numElements)->set(static_cast<double>(i));
+			std::vector<size_t> changed;
+			if (!table.assignDense(copy, changed)) {
+				for (size_t index = 0; index < table.size(); index++) {
+					table.get(index)->assign(*std::as_const(copy).get(index));
+				}
+			}
+		}
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	};
+	auto sparseTime = measure(sparse);
+	auto denseTime = measure(dense);
+
+	std::cout << numIterations << " copy/modify/update cycles of a " << numElements << " element array: separate entries " << sparseTime << " ms, dense " << denseTime << " ms" << std::endl;
+	EXPECT_EQ(sparse.asVector<double>(), dense.asVector<double>());
+}
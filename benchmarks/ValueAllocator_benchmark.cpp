@@ -0,0 +1,127 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "data_storage/BasicAnnotations.h"
+#include "data_storage/BasicTypes.h"
+#include "data_storage/Table.h"
+#include "data_storage/Value.h"
+#include "data_storage/ValueAllocator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace raco::data_storage;
+
+namespace {
+
+constexpr size_t NUM_TABLES = 10000;
+constexpr size_t NUM_VALUES = 100000;
+
+using RangedDouble = Property<double, DisplayNameAnnotation, RangeAnnotation<double>>;
+
+// A Table shaped like the inputs of a typical Lua script.
+void fillTable(Table& table) {
+	for (int i = 0; i < 4; i++) {
+		table.addProperty("double" + std::to_string(i), PrimitiveType::Double);
+		table.addProperty("vector" + std::to_string(i), PrimitiveType::Vec3f);
+		table.addProperty("ranged" + std::to_string(i), std::make_unique<RangedDouble>(0.0, DisplayNameAnnotation("Ranged"), RangeAnnotation<double>(-1.0, 1.0)));
+	}
+	auto nested = table.addProperty("struct", PrimitiveType::Table);
+	nested->asTable().addProperty("flag", PrimitiveType::Bool);
+	nested->asTable().addProperty("name", PrimitiveType::String);
+}
+
+// Time in milliseconds of the fastest of several runs.
+template <typename Function>
+double measure(Function function) {
+	double best = std::numeric_limits<double>::max();
+	for (int run = 0; run < 5; run++) {
+		auto start = std::chrono::steady_clock::now();
+		function();
+		best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+	}
+	return best;
+}
+
+}  // namespace
+
+TEST(ValueAllocatorBenchmark, create_clone_destroy_10k_tables) {
+	std::vector<std::unique_ptr<Table>> tables;
+	auto before = ValueAllocator::statistics();
+	auto create = measure([&tables]() {
+		tables.clear();
+		for (size_t i = 0; i < NUM_TABLES; i++) {
+			tables.emplace_back(std::make_unique<Table>());
+			fillTable(*tables.back());
+		}
+	});
+	auto slabsAfterCreation = ValueAllocator::statistics();
+
+	std::vector<std::unique_ptr<Table>> clones;
+	auto clone = measure([&tables, &clones]() {
+		clones.clear();
+		for (const auto& table : tables) {
+			clones.emplace_back(std::make_unique<Table>(*table));
+		}
+	});
+	double destroy = std::numeric_limits<double>::max();
+	for (int run = 0; run < 5; run++) {
+		clones.clear();
+		for (const auto& table : tables) {
+			clones.emplace_back(std::make_unique<Table>(*table));
+		}
+		auto start = std::chrono::steady_clock::now();
+		clones.clear();
+		destroy = std::min(destroy, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+	}
+	tables.clear();
+	auto after = ValueAllocator::statistics();
+	EXPECT_EQ(after.liveObjects(), before.liveObjects());
+
+	std::cout << NUM_TABLES << " Tables with " << 15 << " values: create " << create << " ms, clone " << clone << " ms, destroy " << destroy << " ms" << std::endl;
+	std::cout << "Value allocations: " << after.allocations - before.allocations << ", slabs: " << slabsAfterCreation.slabs << " (" << slabsAfterCreation.slabBytes / 1024 << " KiB)" << std::endl;
+
+	// Allocator throughput for plain Values without annotations, whose construction is cheap compared to the allocation.
+	std::vector<ValueBase*> values;
+	values.reserve(4 * NUM_VALUES);
+	auto globalNew = measure([&values]() {
+		for (size_t i = 0; i < NUM_VALUES; i++) {
+			values.emplace_back(::new Value<double>());
+			values.emplace_back(::new Value<int>());
+			values.emplace_back(::new Value<std::string>());
+			values.emplace_back(::new Value<Table>());
+		}
+		// Explicit destructor call, since ::delete would pass the size of ValueBase to the global operator delete.
+		for (auto value : values) {
+			value->~ValueBase();
+			::operator delete(value);
+		}
+		values.clear();
+	});
+	auto slabs = measure([&values]() {
+		for (size_t i = 0; i < NUM_VALUES; i++) {
+			values.emplace_back(new Value<double>());
+			values.emplace_back(new Value<int>());
+			values.emplace_back(new Value<std::string>());
+			values.emplace_back(new Value<Table>());
+		}
+		for (auto value : values) {
+			delete value;
+		}
+		values.clear();
+	});
+	std::cout << "Create and destroy " << 4 * NUM_VALUES << " Values: global operator new " << globalNew << " ms, slab allocator " << slabs << " ms" << std::endl;
+}
@@ -0,0 +1,83 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "core/EditorObject.h"
+#include "core/Handles.h"
+#include "data_storage/Table.h"
+
+#include <chrono>
+#include <iostream>
+#include <set>
+#include <unordered_set>
+
+#include "gtest/gtest.h"
+
+using namespace raco::core;
+using namespace raco::data_storage;
+
+namespace {
+
+class BenchmarkTableObject : public EditorObject {
+public:
+	static inline const TypeDescriptor typeDescription = {"BenchmarkTableObject", true};
+	TypeDescriptor const& getTypeDescription() const override {
+		return typeDescription;
+	}
+	BenchmarkTableObject(BenchmarkTableObject const&) = delete;
+	BenchmarkTableObject(std::string name = std::string(), std::string id = std::string()) : EditorObject(name, id) {
+		fillPropertyDescription();
+	}
+
+	void fillPropertyDescription() {
+		properties_.emplace_back("table", &table_);
+	}
+
+	Property<Table> table_{{}};
+};
+
+}  // namespace
+
+TEST(ValueHandleBenchmark, hashed_change_set) {
+	const std::shared_ptr<BenchmarkTableObject> tableObject{std::make_shared<BenchmarkTableObject>("table")};
+	constexpr size_t numEntries = 1000;
+	for (size_t i = 0; i < numEntries; i++) {
+		tableObject->table_.asTable().addProperty(PrimitiveType::Vec3f);
+	}
+
+	std::vector<ValueHandle> handles;
+	ValueHandle table = ValueHandle(tableObject).get("table");
+	for (size_t i = 0; i < numEntries; i++) {
+		for (size_t component = 0; component < 3; component++) {
+			handles.emplace_back(table[i][component]);
+		}
+	}
+	constexpr int numRounds = 100;
+
+	auto start = std::chrono::steady_clock::now();
+	size_t found = 0;
+	for (int round = 0; round < numRounds; round++) {
+		std::set<ValueHandle> ordered(handles.begin(), handles.end());
+		for (const auto& handle : handles) {
+			found += ordered.count(handle);
+		}
+	}
+	auto orderedTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	start = std::chrono::steady_clock::now();
+	for (int round = 0; round < numRounds; round++) {
+		std::unordered_set<ValueHandle> hashed(handles.begin(), handles.end());
+		for (const auto& handle : handles) {
+			found += hashed.count(handle);
+		}
+	}
+	auto hashedTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << numRounds << " rounds of inserting and finding " << handles.size() << " handles: std::set " << orderedTime << " ms, std::unordered_set " << hashedTime << " ms" << std::endl;
+	EXPECT_EQ(found, 2 * numRounds * handles.size());
+}
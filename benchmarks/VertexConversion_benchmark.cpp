@@ -0,0 +1,126 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <gtest/gtest.h>
+
+#include "mesh_loader/VertexConversion.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace raco::mesh_loader::vertex_conversion;
+
+class VertexConversionBenchmark : public ::testing::Test {
+protected:
+	static constexpr size_t numVertices = 1000003;
+
+	void SetUp() override {
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+		vectors.resize(numVertices);
+		for (auto& vector : vectors) {
+			vector = aiVector3D(distribution(generator), distribution(generator), distribution(generator));
+		}
+
+		indices.resize(3 * numVertices);
+		for (size_t i = 0; i < indices.size(); i++) {
+			indices[i] = static_cast<unsigned int>(i % numVertices);
+		}
+		faces.resize(numVertices);
+		for (size_t i = 0; i < numVertices; i++) {
+			faces[i].mNumIndices = 3;
+			faces[i].mIndices = indices.data() + 3 * i;
+		}
+
+		transformation = aiMatrix4x4(aiVector3D(2.0f, 1.0f, 0.5f), aiQuaternion(0.3f, 1.2f, -0.7f), aiVector3D(4.0f, -3.0f, 1.5f));
+		normalTransformation = aiMatrix3x3(transformation);
+		normalTransformation.Inverse().Transpose();
+	}
+
+	void TearDown() override {
+		// The faces don't own their index arrays.
+		for (auto& face : faces) {
+			face.mIndices = nullptr;
+			face.mNumIndices = 0;
+		}
+		setSimdLevel(supportedSimdLevel());
+	}
+
+	// Time in milliseconds of the fastest of several runs.
+	template <typename Function>
+	static double measure(Function function) {
+		double best = std::numeric_limits<double>::max();
+		for (int run = 0; run < 5; run++) {
+			auto start = std::chrono::steady_clock::now();
+			function();
+			best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+		}
+		return best;
+	}
+
+	std::vector<aiVector3D> vectors;
+	std::vector<unsigned int> indices;
+	std::vector<aiFace> faces;
+	aiMatrix4x4 transformation;
+	aiMatrix3x3 normalTransformation;
+};
+
+// Microbenchmark of the conversion kernels against the per-element loops glTFMesh used before.
+TEST_F(VertexConversionBenchmark, conversion_1M_vertices) {
+	std::vector<float> buffer;
+	auto previousVec3 = measure([&]() {
+		buffer.clear();
+		for (const auto& vector : vectors) {
+			buffer.insert(buffer.end(), {vector.x, vector.y, vector.z});
+		}
+	});
+	auto previousVec2 = measure([&]() {
+		buffer.clear();
+		for (const auto& vector : vectors) {
+			buffer.insert(buffer.end(), {vector.x, vector.y});
+		}
+	});
+	std::vector<uint32_t> indexBuffer;
+	auto previousIndices = measure([&]() {
+		indexBuffer.clear();
+		for (const auto& face : faces) {
+			for (unsigned i = 0; i < face.mNumIndices; ++i) {
+				indexBuffer.push_back(face.mIndices[i] + 100);
+			}
+		}
+	});
+	auto previousTransform = measure([&]() {
+		buffer.clear();
+		for (const auto& vector : vectors) {
+			auto point = transformation * vector;
+			buffer.insert(buffer.end(), {point.x, point.y, point.z});
+		}
+	});
+	std::cout << "Previous per-element loops (ms): vec3 " << previousVec3 << ", vec2 " << previousVec2 << ", indices " << previousIndices << ", transform " << previousTransform << std::endl;
+
+	buffer.resize(3 * numVertices);
+	indexBuffer.resize(3 * numVertices);
+	auto copy = measure([&]() { copyVec3(vectors.data(), numVertices, buffer.data()); });
+	auto flatten = measure([&]() { flattenFaceIndices(faces.data(), faces.size(), 100, indexBuffer.data()); });
+	std::cout << "copyVec3 " << copy << " ms, flattenFaceIndices " << flatten << " ms" << std::endl;
+
+	for (auto level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2}) {
+		if (level <= supportedSimdLevel()) {
+			setSimdLevel(level);
+			auto vec2 = measure([&]() { copyVec3ToVec2(vectors.data(), numVertices, buffer.data()); });
+			auto points = measure([&]() { transformPoints(transformation, vectors.data(), numVertices, buffer.data()); });
+			auto directions = measure([&]() { transformDirections(normalTransformation, vectors.data(), numVertices, buffer.data()); });
+			std::cout << "Level " << static_cast<int>(level) << " (ms): copyVec3ToVec2 " << vec2 << ", transformPoints " << points << ", transformDirections " << directions << std::endl;
+		}
+	}
+}
@@ -36,7 +36,9 @@ namespace raco::application {
 
 class RaCoApplication {
 public:
-	explicit RaCoApplication(ramses_base::BaseEngineBackend& engine, const QString& initialProject = {});
+	// With asyncMeshLoading meshes are loaded on worker threads and applied to the project in doOneLoop.
+	explicit RaCoApplication(ramses_base::BaseEngineBackend& engine, const QString& initialProject = {}, bool asyncMeshLoading = false);
+	~RaCoApplication();
 
 	RaCoProject& activeRaCoProject();
 	const RaCoProject& activeRaCoProject() const;
@@ -56,6 +58,9 @@ public:
 
 	void doOneLoop();
 
+	// Block until all pending asynchronous mesh loads are applied to the project and the engine.
+	void finishPendingMeshLoads();
+
 	void resetScene();
 
 	bool canSaveActiveProject() const;
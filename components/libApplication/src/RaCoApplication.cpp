@@ -19,13 +19,14 @@
 #include "ramses_adaptor/LuaScriptAdaptor.h"
 #include "ramses_adaptor/SceneBackend.h"
 #include "ramses_base/BaseEngineBackend.h"
+#include "ramses_base/TextureDataCache.h"
 
 
 #include <ramses_base/LogicEngineFormatter.h>
 
 namespace raco::application {
 
-RaCoApplication::RaCoApplication(ramses_base::BaseEngineBackend& engine, const QString& initialProject)
+RaCoApplication::RaCoApplication(ramses_base::BaseEngineBackend& engine, const QString& initialProject, bool asyncMeshLoading)
 	: engine_{&engine},
 	  dataChangeDispatcher_{std::make_shared<raco::components::DataChangeDispatcher>()},
 	  dataChangeDispatcherEngine_{std::make_shared<raco::components::DataChangeDispatcher>()},
@@ -34,6 +35,8 @@ RaCoApplication::RaCoApplication(ramses_base::BaseEngineBackend& engine, const Q
 	ramses_base::enableLogicLoggerOutputToStdout(false);
 	// Preferences need to be initalized before we have a fist initial project
 	raco::components::RaCoPreferences::init();
+	ramses_base::TextureDataCache::instance().setFileChangeMonitor(&fileChangeMonitor_);
+	meshCache_.setAsyncLoading(asyncMeshLoading);
 	std::vector<std::string> stack;
 	activeProject_ = initialProject.isEmpty() ? RaCoProject::createNew(this) : RaCoProject::loadFromFile(initialProject, this, stack);
 	externalProjectsStore_.setActiveProject(activeProject_.get());
@@ -46,6 +49,10 @@ RaCoApplication::RaCoApplication(ramses_base::BaseEngineBackend& engine, const Q
 	startTime_ = std::chrono::high_resolution_clock::now();
 }
 
+RaCoApplication::~RaCoApplication() {
+	ramses_base::TextureDataCache::instance().setFileChangeMonitor(nullptr);
+}
+
 RaCoProject& RaCoApplication::activeRaCoProject() {
 	return *activeProject_.get();
 }
@@ -93,11 +100,16 @@ void RaCoApplication::switchActiveRaCoProject(const QString& file) {
 bool RaCoApplication::exportProject(const RaCoProject& project, const std::string& ramsesExport, const std::string& logicExport, bool compress, std::string& outError) const {
 	// we currently only support export of active project currently
 	assert(&project == &activeRaCoProject());
+	if (meshCache_.hasPendingLoads()) {
+		outError = "Meshes are still being loaded.";
+		return false;
+	}
 	auto status = scenesBackend_->currentScene()->saveToFile(ramsesExport.c_str(), compress);
 	if (status != ramses::StatusOK) {
 		outError = scenesBackend_->currentScene()->getStatusMessage(status);
 		return false;
 	}
+	engine_->logicEngine().luaScriptCache().releaseCompiledScripts();
 	if (!engine_->logicEngine().saveToFile(logicExport.c_str())) {
 		if (engine_->logicEngine().getErrors().size() > 0) {
 			outError = engine_->logicEngine().getErrors().at(0).message;
@@ -110,6 +122,8 @@ bool RaCoApplication::exportProject(const RaCoProject& project, const std::strin
 }
 
 void RaCoApplication::doOneLoop() {
+	meshCache_.processCompletedLoads();
+
 	// write data into engine
 	if (ramses_adaptor::SceneBackend::toSceneId(*activeRaCoProject().project()->settings()->sceneId_) != scenesBackend_->currentSceneId()) {
 		scenesBackend_->setScene(activeRaCoProject().project(), activeRaCoProject().errors());
@@ -142,6 +156,13 @@ void RaCoApplication::doOneLoop() {
 	dataChangeDispatcher_->dispatch(dataChanges);
 }
 
+void RaCoApplication::finishPendingMeshLoads() {
+	if (meshCache_.hasPendingLoads()) {
+		meshCache_.waitForPendingLoads();
+		doOneLoop();
+	}
+}
+
 bool RaCoApplication::canSaveActiveProject() const {
 	for (auto item : activeProject_->project()->externalProjectsMap()) {
 		auto absPath = activeProject_->project()->lookupExternalProjectPath(item.first);
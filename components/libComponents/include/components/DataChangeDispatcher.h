@@ -115,8 +115,8 @@ public:
 	}
 
 private:
-	void emitUpdateFor(const std::map<std::string, std::set<core::ValueHandle>>& valueHandles);
-	void emitErrorChanged(const core::ValueHandle& valueHandle);
+	void emitUpdateFor(const std::unordered_map<std::string, std::unordered_set<core::ValueHandle>>& valueHandles);
+	void emitErrorChanged(const std::unordered_set<core::ValueHandle>& valueHandles);
 	void emitErrorChangedInScene();
 	void emitCreated(core::SEditorObject obj);
 	void emitDeleted(core::SEditorObject obj);
@@ -12,10 +12,18 @@
 #include "components/FileChangeMonitorImpl.h"
 #include "core/MeshCacheInterface.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <unordered_set>
+#include <vector>
 
 namespace raco::core {
 class BaseContext;
@@ -26,22 +34,89 @@ namespace raco::components {
 class MeshCacheImpl : public GenericFileChangeMonitorImpl<core::MeshCache> {
 public:
 	MeshCacheImpl() {}
+	~MeshCacheImpl();
 
 	core::SharedMeshData loadMesh(const raco::core::MeshDescriptor& descriptor) override;
 	core::MeshScenegraph getMeshScenegraph(const std::string& absPath, bool bakeAllSubmeshes) override;
 	std::string getMeshError(const std::string& absPath) override;
 	int getTotalMeshCount(const std::string& absPath, bool bakeAllSubmeshes) override;
+	core::MeshCacheStatistics statistics() const override;
+
+	static constexpr size_t defaultMemoryBudget = 512 * 1024 * 1024;
+
+	// Entries of files not used by any Mesh are evicted in least recently used order while the cache exceeds the budget.
+	void setMemoryBudget(size_t bytes);
+
+	// Imported meshes are additionally stored in and loaded from a persistent cache in this directory.
+	// The persistent cache is shared by all MeshCacheImpl instances and disabled by default.
+	static void setDiskCacheDirectory(const std::string& directory);
+
+	LoadHandle loadMeshAsync(const raco::core::MeshDescriptor& descriptor, LoadCallback callback) override;
+	void processCompletedLoads() override;
+	bool hasPendingLoads() const override;
+
+	// Asynchronous loading is disabled by default, so that loadMeshAsync behaves like loadMesh.
+	void setAsyncLoading(bool enable);
+	// Block until all pending loads are done and process them.
+	void waitForPendingLoads();
 
 private:
+	// The loaders are not thread-safe: every access has to lock the mutex of the entry.
+	struct Entry {
+		core::UniqueMeshCacheEntry loader;
+		std::mutex mutex;
+		// Submesh index, baking, optimization, level of detail and quantization of a loaded mesh.
+		using MeshKey = std::tuple<int, bool, bool, int, bool>;
+		// Loaded meshes, shared by all Mesh objects using the same descriptor.
+		std::map<MeshKey, core::SharedMeshData> meshes;
+		// Importer state plus mesh buffers in bytes.
+		std::atomic<size_t> size{0};
+		// Only accessed on the main thread.
+		uint64_t lastUse{0};
+		int64_t modificationTime{0};
+	};
+
+	struct LoadRequest {
+		core::MeshDescriptor descriptor;
+		LoadCallback callback;
+		std::shared_ptr<Entry> entry;
+		std::atomic<bool> cancelled{false};
+		core::SharedMeshData result;
+	};
+
 	virtual void unregister(std::string absPath, typename core::MeshCache::Callback* listener) override;
 	virtual void notify(const std::string& absPath) override;
 
 	core::MeshCacheEntry* getLoader(std::string absPath) override;
+	std::shared_ptr<Entry> getEntry(const std::string& absPath);
 
 	void forceReloadCachedMesh(const std::string& absPath);
 	void onAfterMeshFileUpdate(const std::string& meshFileAbsPath);
 
-	std::unordered_map<std::string, core::UniqueMeshCacheEntry> meshCacheEntries_;
+	// Called on the main thread and the worker threads.
+	core::SharedMeshData loadFromEntry(Entry& entry, const raco::core::MeshDescriptor& descriptor);
+	void evictUnusedEntries();
+
+	void runWorker();
+
+	std::unordered_map<std::string, std::shared_ptr<Entry>> meshCacheEntries_;
+	size_t memoryBudget_{defaultMemoryBudget};
+	uint64_t useCounter_{0};
+	std::atomic<size_t> hitCount_{0};
+	std::atomic<size_t> missCount_{0};
+	size_t evictionCount_{0};
+
+	bool asyncLoading_{false};
+	// Number of requests not yet handled by processCompletedLoads; only accessed on the main thread.
+	size_t pendingLoads_{0};
+	std::vector<std::thread> workers_;
+	std::mutex queueMutex_;
+	std::condition_variable queueCondition_;
+	std::deque<std::shared_ptr<LoadRequest>> queue_;
+	bool stopWorkers_{false};
+	std::mutex completedMutex_;
+	std::condition_variable completedCondition_;
+	std::vector<std::shared_ptr<LoadRequest>> completed_;
 };
 
 }  // namespace raco::components
\ No newline at end of file
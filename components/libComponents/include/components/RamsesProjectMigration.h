@@ -37,7 +37,10 @@ namespace raco::components {
  * 13: Introduced Struct properties and converted
  *     - material and meshnode blend options
  *     - camera viewport and frustum
+ * 14: Added mesh optimization flag [user_types::Mesh]
+ * 15: Added level of detail selection [user_types::Mesh]
+ * 16: Added attribute quantization flag [user_types::Mesh]
  */
-constexpr int RAMSES_PROJECT_FILE_VERSION = 13;
+constexpr int RAMSES_PROJECT_FILE_VERSION = 16;
 QJsonDocument migrateProject(const QJsonDocument& doc);
 }  // namespace raco::components
@@ -206,13 +206,13 @@ void DataChangeDispatcher::dispatch(const DataChangeRecorder& dataChanges) {
 
 	emitUpdateFor(dataChanges.getChangedValues());
 
-	auto changedErrors = dataChanges.getChangedErrors();
+	const auto& changedErrors = dataChanges.getChangedErrors();
 	for (auto& changedValueHandle : changedErrors) {
 		LOG_TRACE_IF(log_system::DATA_CHANGE, changedValueHandle  && !changedValueHandle.isObject(), "emit errorChanged for Property {}:{}", changedValueHandle.rootObject()->objectName(), changedValueHandle.getPropName());
 		LOG_TRACE_IF(log_system::DATA_CHANGE, changedValueHandle && changedValueHandle.isObject(), "emit errorChanged for Object {}:{}", changedValueHandle.rootObject()->objectName(), changedValueHandle.rootObject()->objectID());
 		LOG_TRACE_IF(log_system::DATA_CHANGE, !changedValueHandle, "emit errorChanged for project-global ValueHandle");
-		emitErrorChanged(changedValueHandle);
 	}
+	emitErrorChanged(changedErrors);
 
 	if (!changedErrors.empty()) {
 		LOG_TRACE(log_system::DATA_CHANGE, "emit errorChangedInScene");
@@ -415,27 +415,28 @@ void DataChangeDispatcher::resetBulkChangeCallback() {
 	bulkChangeCallback_ = nullptr;
 }
 
-void DataChangeDispatcher::emitUpdateFor(const std::map<std::string, std::set<core::ValueHandle>>& valueHandles) {
+void DataChangeDispatcher::emitUpdateFor(const std::unordered_map<std::string, std::unordered_set<core::ValueHandle>>& valueHandles) {
 	decltype(listeners_)::mapped_type dirtyListeners;
 
 	for (const auto& [objectID, cont] : valueHandles) {
+		// Look up each listener in the changed set instead of comparing every listener with every changed handle.
+		auto listenerIt = listeners_.find(objectID);
+		if (listenerIt != listeners_.end()) {
+			for (const auto& ptr : listenerIt->second) {
+				if (!ptr.expired()) {
+					auto listener{ptr.lock()};
+					if (cont.find(listener->valueHandle()) != cont.end()) {
+						dirtyListeners.insert(ptr);
+					}
+				}
+			}
+		}
+
 		for (const auto& valueHandle : cont) {
 			LOG_TRACE_IF(log_system::DATA_CHANGE, valueHandle && !valueHandle.isObject(), "emit changedValueHandle Property {}:{}", valueHandle.rootObject()->objectName(), valueHandle.getPropName());
 			LOG_TRACE_IF(log_system::DATA_CHANGE, valueHandle && valueHandle.isObject(), "emit changedValueHandle Object {}:{}", valueHandle.rootObject()->objectName(), valueHandle.rootObject()->objectID());
 			LOG_TRACE_IF(log_system::DATA_CHANGE, !valueHandle, "emit changedValueHandle project-global");
 
-			auto listenerIt = listeners_.find(objectID);
-			if (listenerIt != listeners_.end()) {
-				for (const auto& ptr : listenerIt->second) {
-					if (!ptr.expired()) {
-						auto listener{ptr.lock()};
-						if (listener->valueHandle() == valueHandle) {
-							dirtyListeners.insert(ptr);
-						}
-					}
-				}
-			}
-
 			decltype(childrenListeners_)::mapped_type dirtyChildrenListeners;
 			auto childListenerIt = childrenListeners_.find(objectID);
 			if (childListenerIt != childrenListeners_.end()) {
@@ -482,12 +483,15 @@ void DataChangeDispatcher::emitUpdateFor(const std::map<std::string, std::set<co
 	}
 }
 
-void DataChangeDispatcher::emitErrorChanged(const ValueHandle& valueHandle) {
+void DataChangeDispatcher::emitErrorChanged(const std::unordered_set<core::ValueHandle>& valueHandles) {
+	if (valueHandles.empty()) {
+		return;
+	}
 	auto copy{errorChangedListeners_};
 	for (const auto& ptr : copy) {
 		if (!ptr.expired()) {
 			auto listener{ptr.lock()};
-			if (listener->valueHandle() == valueHandle) {
+			if (valueHandles.find(listener->valueHandle()) != valueHandles.end()) {
 				listener->call();
 			}
 		}
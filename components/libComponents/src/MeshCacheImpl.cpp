@@ -15,18 +15,41 @@
 #include "components/FileChangeMonitorImpl.h"
 
 #include "mesh_loader/CTMFileLoader.h"
+#include "mesh_loader/DiskCachedFileLoader.h"
+#include "mesh_loader/MeshDiskCache.h"
 #include "mesh_loader/glTFFileLoader.h"
 
 #include "utils/stdfilesystem.h"
+#include <algorithm>
 #include <memory>
 
 namespace raco::components {
 
+namespace {
+
+int64_t modificationTime(const std::string &absPath) {
+	std::error_code ec;
+	auto time = std::filesystem::last_write_time(absPath, ec);
+	return ec ? 0 : static_cast<int64_t>(time.time_since_epoch().count());
+}
+
+}  // namespace
+
+MeshCacheImpl::~MeshCacheImpl() {
+	{
+		std::lock_guard<std::mutex> lock(queueMutex_);
+		stopWorkers_ = true;
+	}
+	queueCondition_.notify_all();
+	for (auto &worker : workers_) {
+		worker.join();
+	}
+}
+
 void MeshCacheImpl::unregister(std::string absPath, typename core::MeshCache::Callback *listener) {
 	GenericFileChangeMonitorImpl<core::MeshCache>::unregister(absPath, listener);
-	if (callbacks_.find(absPath) == callbacks_.end()) {
-		meshCacheEntries_.erase(absPath);
-	}
+	// Entries no longer used by any Mesh are kept for reuse until they are evicted.
+	evictUnusedEntries();
 }
 	
 void MeshCacheImpl::notify(const std::string &absPath) {
@@ -35,28 +58,191 @@ void MeshCacheImpl::notify(const std::string &absPath) {
 }
 
 raco::core::SharedMeshData MeshCacheImpl::loadMesh(const raco::core::MeshDescriptor &descriptor) {
-	auto *loader = getLoader(descriptor.absPath);
-	return loader->loadMesh(descriptor);
+	auto mesh = loadFromEntry(*getEntry(descriptor.absPath), descriptor);
+	evictUnusedEntries();
+	return mesh;
+}
+
+raco::core::SharedMeshData MeshCacheImpl::loadFromEntry(Entry &entry, const raco::core::MeshDescriptor &descriptor) {
+	std::lock_guard<std::mutex> lock(entry.mutex);
+	Entry::MeshKey key{descriptor.bakeAllSubmeshes ? 0 : descriptor.submeshIndex, descriptor.bakeAllSubmeshes, descriptor.optimizeMesh, descriptor.lodLevel, descriptor.quantizeAttributes};
+	auto it = entry.meshes.find(key);
+	if (it != entry.meshes.end()) {
+		++hitCount_;
+		return it->second;
+	}
+
+	++missCount_;
+	auto mesh = entry.loader->loadMesh(descriptor);
+	if (mesh) {
+		entry.meshes[key] = mesh;
+	}
+	size_t size = entry.loader->memoryUsage();
+	for (const auto &[loadedKey, loadedMesh] : entry.meshes) {
+		size += loadedMesh->memoryUsage();
+	}
+	entry.size = size;
+	return mesh;
+}
+
+void MeshCacheImpl::evictUnusedEntries() {
+	size_t bytesHeld = 0;
+	for (const auto &[path, entry] : meshCacheEntries_) {
+		bytesHeld += entry->size;
+	}
+	while (bytesHeld > memoryBudget_) {
+		auto lru = meshCacheEntries_.end();
+		for (auto it = meshCacheEntries_.begin(); it != meshCacheEntries_.end(); ++it) {
+			if (callbacks_.find(it->first) == callbacks_.end() && (lru == meshCacheEntries_.end() || it->second->lastUse < lru->second->lastUse)) {
+				lru = it;
+			}
+		}
+		if (lru == meshCacheEntries_.end()) {
+			break;
+		}
+		LOG_DEBUG(log_system::MESH_LOADER, "Evicting mesh cache entry {} ({} bytes)", lru->first, lru->second->size.load());
+		bytesHeld -= lru->second->size;
+		meshCacheEntries_.erase(lru);
+		++evictionCount_;
+	}
+}
+
+raco::core::MeshCacheStatistics MeshCacheImpl::statistics() const {
+	core::MeshCacheStatistics statistics;
+	statistics.hits = hitCount_;
+	statistics.misses = missCount_;
+	statistics.evictions = evictionCount_;
+	statistics.entries = meshCacheEntries_.size();
+	for (const auto &[path, entry] : meshCacheEntries_) {
+		statistics.bytesHeld += entry->size;
+	}
+	statistics.memoryBudget = memoryBudget_;
+	return statistics;
+}
+
+void MeshCacheImpl::setMemoryBudget(size_t bytes) {
+	memoryBudget_ = bytes;
+	evictUnusedEntries();
+}
+
+void MeshCacheImpl::setDiskCacheDirectory(const std::string &directory) {
+	mesh_loader::MeshDiskCache::instance().setCacheDirectory(directory);
 }
 
 raco::core::MeshScenegraph raco::components::MeshCacheImpl::getMeshScenegraph(const std::string &absPath, bool bakeAllSubmeshes) {
-	auto *loader = getLoader(absPath);
-	return loader->getScenegraph(bakeAllSubmeshes);
+	auto entry = getEntry(absPath);
+	std::lock_guard<std::mutex> lock(entry->mutex);
+	return entry->loader->getScenegraph(bakeAllSubmeshes);
 }
 
 std::string raco::components::MeshCacheImpl::getMeshError(const std::string &absPath) {
-	auto *loader = getLoader(absPath);
-	return loader->getError();
+	auto entry = getEntry(absPath);
+	std::lock_guard<std::mutex> lock(entry->mutex);
+	return entry->loader->getError();
 }
 
 int raco::components::MeshCacheImpl::getTotalMeshCount(const std::string &absPath, bool bakeAllSubmeshes) {
-	auto *loader = getLoader(absPath);
-	return loader->getTotalMeshCount(bakeAllSubmeshes);
+	auto entry = getEntry(absPath);
+	std::lock_guard<std::mutex> lock(entry->mutex);
+	return entry->loader->getTotalMeshCount(bakeAllSubmeshes);
+}
+
+raco::core::MeshCache::LoadHandle MeshCacheImpl::loadMeshAsync(const raco::core::MeshDescriptor &descriptor, LoadCallback callback) {
+	if (!asyncLoading_) {
+		callback(loadMesh(descriptor));
+		return LoadHandle(nullptr, [](void *) {});
+	}
+
+	auto request = std::make_shared<LoadRequest>();
+	request->descriptor = descriptor;
+	request->callback = std::move(callback);
+	request->entry = getEntry(descriptor.absPath);
+	{
+		std::lock_guard<std::mutex> lock(queueMutex_);
+		if (workers_.empty()) {
+			auto numWorkers = std::max(1u, std::thread::hardware_concurrency());
+			for (unsigned i = 0; i < numWorkers; i++) {
+				workers_.emplace_back([this]() { runWorker(); });
+			}
+		}
+		queue_.emplace_back(request);
+	}
+	++pendingLoads_;
+	queueCondition_.notify_one();
+
+	return LoadHandle(request.get(), [request](void *) {
+		request->cancelled = true;
+	});
+}
+
+void MeshCacheImpl::runWorker() {
+	while (true) {
+		std::shared_ptr<LoadRequest> request;
+		{
+			std::unique_lock<std::mutex> lock(queueMutex_);
+			queueCondition_.wait(lock, [this]() { return stopWorkers_ || !queue_.empty(); });
+			if (stopWorkers_) {
+				return;
+			}
+			request = queue_.front();
+			queue_.pop_front();
+		}
+
+		// Loads which have been superseded before they started are skipped.
+		if (!request->cancelled) {
+			request->result = loadFromEntry(*request->entry, request->descriptor);
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(completedMutex_);
+			completed_.emplace_back(request);
+		}
+		completedCondition_.notify_all();
+	}
+}
+
+void MeshCacheImpl::processCompletedLoads() {
+	std::vector<std::shared_ptr<LoadRequest>> completed;
+	{
+		std::lock_guard<std::mutex> lock(completedMutex_);
+		completed.swap(completed_);
+	}
+	for (const auto &request : completed) {
+		--pendingLoads_;
+		if (!request->cancelled) {
+			request->callback(request->result);
+		}
+	}
+	if (!completed.empty()) {
+		evictUnusedEntries();
+	}
+}
+
+bool MeshCacheImpl::hasPendingLoads() const {
+	return pendingLoads_ > 0;
+}
+
+void MeshCacheImpl::setAsyncLoading(bool enable) {
+	asyncLoading_ = enable;
+}
+
+void MeshCacheImpl::waitForPendingLoads() {
+	while (hasPendingLoads()) {
+		{
+			std::unique_lock<std::mutex> lock(completedMutex_);
+			completedCondition_.wait(lock, [this]() { return !completed_.empty(); });
+		}
+		processCompletedLoads();
+	}
 }
 
 void MeshCacheImpl::forceReloadCachedMesh(const std::string &absPath) {
-	auto *loader = getLoader(absPath);
-	loader->reset();
+	auto entry = getEntry(absPath);
+	std::lock_guard<std::mutex> lock(entry->mutex);
+	entry->loader->reset();
+	entry->meshes.clear();
+	entry->size = 0;
+	entry->modificationTime = modificationTime(absPath);
 }
 
 void MeshCacheImpl::onAfterMeshFileUpdate(const std::string &meshFileAbsPath) {
@@ -76,15 +262,29 @@ bool endsWith(std::string const &text, std::string const &ending) {
 }
 
 raco::core::MeshCacheEntry *MeshCacheImpl::getLoader(std::string absPath) {
-	if (meshCacheEntries_.count(absPath) == 0) {
+	return getEntry(absPath)->loader.get();
+}
+
+std::shared_ptr<MeshCacheImpl::Entry> MeshCacheImpl::getEntry(const std::string &absPath) {
+	auto &entry = meshCacheEntries_[absPath];
+	if (entry && callbacks_.find(absPath) == callbacks_.end() && entry->modificationTime != modificationTime(absPath)) {
+		// Changes of files not watched while the entry was unused are not notified.
+		entry.reset();
+	}
+	if (!entry) {
+		entry = std::make_shared<Entry>();
+		raco::core::UniqueMeshCacheEntry loader;
 		if (endsWith(absPath, ".gltf") || endsWith(absPath, ".glb")) {
-			meshCacheEntries_[absPath] = std::unique_ptr<raco::core::MeshCacheEntry>(new mesh_loader::glTFFileLoader(absPath));
+			loader = std::unique_ptr<raco::core::MeshCacheEntry>(new mesh_loader::glTFFileLoader(absPath));
 
 		} else {
-			meshCacheEntries_[absPath] = std::unique_ptr<raco::core::MeshCacheEntry>(new mesh_loader::CTMFileLoader(absPath));
+			loader = std::unique_ptr<raco::core::MeshCacheEntry>(new mesh_loader::CTMFileLoader(absPath));
 		}
+		entry->loader = std::make_unique<mesh_loader::DiskCachedFileLoader>(absPath, std::move(loader));
+		entry->modificationTime = modificationTime(absPath);
 	}
-	return meshCacheEntries_[absPath].get();
+	entry->lastUse = ++useCounter_;
+	return entry;
 }
 
 }  // namespace raco::components
\ No newline at end of file
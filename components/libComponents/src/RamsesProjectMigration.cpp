@@ -531,6 +531,8 @@ QJsonDocument migrateProject(const QJsonDocument& document) {
 		documentObject[raco::serialization::keys::LINKS] = outJsonLinks;
 	}
 
+	// File Version 14..16: no migration code needed
+
 	QJsonDocument newDocument{documentObject};
 	// for debugging:
 	//auto migratedJSON = QString(newDocument.toJson()).toStdString();
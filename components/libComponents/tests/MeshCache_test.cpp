@@ -0,0 +1,121 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "gtest/gtest.h"
+
+#include "components/MeshCacheImpl.h"
+#include "testing/TestEnvironmentCore.h"
+#include "user_types/Mesh.h"
+
+using namespace raco::core;
+using raco::user_types::Mesh;
+using raco::user_types::SMesh;
+
+class MeshCacheTest : public TestEnvironmentCore {};
+
+TEST_F(MeshCacheTest, synchronous_load_by_default) {
+	auto mesh = create<Mesh>("mesh");
+	commandInterface.set({mesh, {"uri"}}, (cwd_path() / "meshes" / "Duck.glb").string());
+
+	EXPECT_FALSE(mesh->isLoading());
+	EXPECT_FALSE(meshCache.hasPendingLoads());
+	EXPECT_NE(mesh->meshData(), nullptr);
+}
+
+TEST_F(MeshCacheTest, async_load_completes_in_process) {
+	meshCache.setAsyncLoading(true);
+	auto mesh = create<Mesh>("mesh");
+	commandInterface.set({mesh, {"uri"}}, (cwd_path() / "meshes" / "Duck.glb").string());
+
+	EXPECT_TRUE(mesh->isLoading());
+	EXPECT_EQ(mesh->meshData(), nullptr);
+	EXPECT_TRUE(meshCache.hasPendingLoads());
+
+	EXPECT_EQ(mesh->materialNames(), std::vector<std::string>{"material"});
+	auto undoStackSize = undoStack.size();
+
+	meshCache.waitForPendingLoads();
+
+	EXPECT_FALSE(mesh->isLoading());
+	EXPECT_FALSE(meshCache.hasPendingLoads());
+	ASSERT_NE(mesh->meshData(), nullptr);
+	EXPECT_TRUE(recorder.getPreviewDirtyObjects().find(mesh) != recorder.getPreviewDirtyObjects().end());
+
+	// The completion must not change the data model outside of a command.
+	EXPECT_TRUE(context.modelChanges().getAllChangedObjects(true).empty());
+	EXPECT_EQ(undoStack.size(), undoStackSize);
+}
+
+TEST_F(MeshCacheTest, async_load_completion_after_delete_is_ignored) {
+	meshCache.setAsyncLoading(true);
+	auto mesh = create<Mesh>("mesh");
+	commandInterface.set({mesh, {"uri"}}, (cwd_path() / "meshes" / "Duck.glb").string());
+	EXPECT_TRUE(mesh->isLoading());
+
+	commandInterface.deleteObjects({mesh});
+	meshCache.waitForPendingLoads();
+
+	EXPECT_EQ(mesh->meshData(), nullptr);
+}
+
+TEST_F(MeshCacheTest, async_load_outdated_request_is_cancelled) {
+	meshCache.setAsyncLoading(true);
+	auto mesh = create<Mesh>("mesh");
+	commandInterface.set({mesh, {"uri"}}, (cwd_path() / "meshes" / "CesiumMilkTruck" / "CesiumMilkTruck.gltf").string());
+	commandInterface.set({mesh, {"bakeMeshes"}}, false);
+	commandInterface.set({mesh, {"meshIndex"}}, 1);
+
+	int callbackCount = 0;
+	auto handle = meshCache.loadMeshAsync({(cwd_path() / "meshes" / "Duck.glb").string(), 0, true}, [&callbackCount](SharedMeshData) { callbackCount++; });
+	handle.reset();
+
+	meshCache.waitForPendingLoads();
+
+	EXPECT_EQ(callbackCount, 0);
+	EXPECT_FALSE(mesh->isLoading());
+	ASSERT_NE(mesh->meshData(), nullptr);
+	auto expected = meshCache.loadMesh({(cwd_path() / "meshes" / "CesiumMilkTruck" / "CesiumMilkTruck.gltf").string(), 1, false});
+	EXPECT_EQ(mesh->meshData()->numVertices(), expected->numVertices());
+}
+
+TEST_F(MeshCacheTest, statistics_count_hits_and_misses) {
+	auto duckPath = (cwd_path() / "meshes" / "Duck.glb").string();
+	auto first = create<Mesh>("first");
+	commandInterface.set({first, {"uri"}}, duckPath);
+	auto second = create<Mesh>("second");
+	commandInterface.set({second, {"uri"}}, duckPath);
+
+	auto statistics = meshCache.statistics();
+	EXPECT_EQ(statistics.misses, 1);
+	EXPECT_EQ(statistics.hits, 1);
+	EXPECT_EQ(statistics.entries, 1);
+	EXPECT_GT(statistics.bytesHeld, first->meshData()->memoryUsage());
+	EXPECT_EQ(first->meshData(), second->meshData());
+}
+
+TEST_F(MeshCacheTest, unused_entries_evicted_over_budget) {
+	auto duckPath = (cwd_path() / "meshes" / "Duck.glb").string();
+	auto truckPath = (cwd_path() / "meshes" / "CesiumMilkTruck" / "CesiumMilkTruck.gltf").string();
+	auto mesh = create<Mesh>("mesh");
+	commandInterface.set({mesh, {"uri"}}, duckPath);
+	commandInterface.set({mesh, {"uri"}}, truckPath);
+
+	// The Duck entry is not used anymore but kept within the budget.
+	EXPECT_EQ(meshCache.statistics().entries, 2);
+
+	meshCache.setMemoryBudget(0);
+	auto statistics = meshCache.statistics();
+	EXPECT_EQ(statistics.entries, 1);
+	EXPECT_EQ(statistics.evictions, 1);
+	EXPECT_NE(mesh->meshData(), nullptr);
+
+	// Reusing the evicted file loads it again.
+	commandInterface.set({mesh, {"uri"}}, duckPath);
+	EXPECT_EQ(meshCache.statistics().misses, statistics.misses + 1);
+}
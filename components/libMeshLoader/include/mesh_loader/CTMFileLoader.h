@@ -25,13 +25,14 @@ public:
 	void reset() override;
 	raco::core::MeshScenegraph getScenegraph(bool bakeAllSubmeshes) override;
 	int getTotalMeshCount(bool bakeAllSubmeshes) override;
+	size_t memoryUsage() const override;
 
 private:
 	bool loadFile();
 
 	std::string path_;
 	std::string error_;
-	std::unique_ptr<CTMimporter> importer_;
+	std::shared_ptr<CTMimporter> importer_;
 	bool valid_;
 };
 
@@ -11,6 +11,7 @@
 
 #include "core/MeshCacheInterface.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -20,14 +21,15 @@ namespace raco::mesh_loader {
 
 class CTMMesh : public raco::core::MeshData {
 public:
-	CTMMesh(CTMimporter& importer);
+	// The mesh buffers are not copied: the mesh keeps the importer alive and uses its arrays directly.
+	CTMMesh(std::shared_ptr<CTMimporter> importer);
 
 	uint32_t numSubmeshes() const override;
 	uint32_t numTriangles() const override;
 	uint32_t numVertices() const override;
 
 
-	const std::vector<uint32_t>& getIndices() const override;
+	core::SharedBuffer<uint32_t> getIndices() const override;
 	std::vector<std::string> getMaterialNames() const override;
 
 	const std::vector<IndexBufferRangeInfo>& submeshIndexBufferRanges() const override;
@@ -43,13 +45,13 @@ private:
 	struct Attribute {
 		std::string name;
 		VertexAttribDataType type;
-		std::vector<float> data;
+		core::SharedBuffer<float> data;
 	};
 
 	uint32_t numTriangles_;
 	uint32_t numVertices_;
 
-	std::vector<uint32_t> indexBuffer_;
+	core::SharedBuffer<uint32_t> indexBuffer_;
 	std::vector<Attribute> attributes_;
 	std::vector<IndexBufferRangeInfo> submeshIndexBufferRanges_;
 };
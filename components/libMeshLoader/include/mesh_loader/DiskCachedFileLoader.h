@@ -0,0 +1,46 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include "core/MeshCacheInterface.h"
+
+#include <map>
+#include <optional>
+
+namespace raco::mesh_loader {
+
+// Loader which looks up meshes in the MeshDiskCache before importing them with the wrapped loader.
+// Meshes imported by the wrapped loader are stored in the disk cache.
+class DiskCachedFileLoader : public raco::core::MeshCacheEntry {
+public:
+	DiskCachedFileLoader(std::string absPath, raco::core::UniqueMeshCacheEntry loader);
+	virtual ~DiskCachedFileLoader() = default;
+
+	raco::core::SharedMeshData loadMesh(const raco::core::MeshDescriptor& descriptor) override;
+	std::string getError() override;
+	void reset() override;
+	raco::core::MeshScenegraph getScenegraph(bool bakeAllSubmeshes) override;
+	int getTotalMeshCount(bool bakeAllSubmeshes) override;
+	size_t memoryUsage() const override;
+
+private:
+	struct CachedFileInfo {
+		raco::core::MeshScenegraph scenegraph;
+		int totalMeshCount;
+	};
+
+	std::string path_;
+	raco::core::UniqueMeshCacheEntry loader_;
+	std::optional<uint64_t> fileKey_;
+	// File information of records loaded from the disk cache, by baking; empty once the wrapped loader has loaded the file.
+	std::map<bool, CachedFileInfo> cachedFileInfo_;
+};
+
+}  // namespace raco::mesh_loader
@@ -0,0 +1,76 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include "core/MeshCacheInterface.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+
+namespace raco::mesh_loader {
+
+/**
+ * Persistent cache of imported meshes in their final MeshData layout.
+ *
+ * Each record holds one mesh for a file and MeshDescriptor together with the scenegraph and mesh count of the file.
+ * Records are keyed by a hash of the file content, so they stay valid when projects or files are moved.
+ * Loaded records are memory-mapped: the attribute buffers of the returned MeshData point directly into the mapping.
+ * The total size of the cache directory is limited: the least recently used records (by modification time, which is
+ * updated on every hit) are removed when a record is stored.
+ * The cache is disabled until a cache directory is set. All functions are thread-safe.
+ */
+class MeshDiskCache {
+public:
+	struct Record {
+		core::SharedMeshData mesh;
+		core::MeshScenegraph scenegraph;
+		int totalMeshCount{0};
+	};
+
+	static MeshDiskCache& instance();
+
+	static constexpr uint64_t defaultSizeLimit = 1ULL << 30;
+
+	void setCacheDirectory(const std::string& directory);
+	bool enabled() const;
+
+	// Set the maximum total size of the cache directory in bytes and remove records exceeding it.
+	void setSizeLimit(uint64_t bytes);
+
+	// Hash of the file content and the version of the import code. For glTF files the content of the external buffers
+	// and images referenced by the file is included as well. Returns nullopt if the file can't be read.
+	static std::optional<uint64_t> fileKey(const std::string& absPath);
+
+	std::optional<Record> load(uint64_t fileKey, const core::MeshDescriptor& descriptor);
+	void store(uint64_t fileKey, const core::MeshDescriptor& descriptor, const core::MeshData& mesh, const core::MeshScenegraph& scenegraph, int totalMeshCount);
+
+	size_t hitCount() const {
+		return hitCount_;
+	}
+	size_t missCount() const {
+		return missCount_;
+	}
+
+private:
+	std::string recordPath(uint64_t fileKey, const core::MeshDescriptor& descriptor) const;
+	// Remove the least recently used files until the directory fits into the size limit; called with mutex_ locked.
+	void prune();
+
+	mutable std::mutex mutex_;
+	std::string directory_;
+	uint64_t sizeLimit_{defaultSizeLimit};
+	std::atomic<size_t> hitCount_{0};
+	std::atomic<size_t> missCount_{0};
+};
+
+}  // namespace raco::mesh_loader
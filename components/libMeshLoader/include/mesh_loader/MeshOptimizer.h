@@ -0,0 +1,63 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include "core/MeshCacheInterface.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace raco::mesh_loader {
+
+// Size of the simulated post-transform vertex cache used for optimization and ACMR measurement.
+constexpr size_t DEFAULT_VERTEX_CACHE_SIZE = 16;
+
+// Average cache miss ratio: vertex shader invocations per triangle of a FIFO post-transform vertex cache.
+// Ranges from 0.5 (best case for large regular meshes) to 3.0 (no vertex reuse at all).
+double averageCacheMissRatio(const uint32_t* indices, size_t indexCount, size_t cacheSize = DEFAULT_VERTEX_CACHE_SIZE);
+
+/**
+ * Return an optimized copy of a triangle mesh:
+ * - vertices with identical data in all attributes are merged,
+ * - triangles of each submesh are reordered for post-transform cache locality with the Tipsify algorithm
+ *   (Sander, Nehab, Barczak: "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw", 2007),
+ *   and the resulting clusters are sorted front to back by their view-independent occlusion potential,
+ * - vertices are reordered by first use for vertex fetch locality.
+ * The rendered result is identical to the original mesh.
+ * Returns nullptr if the mesh can't be optimized, e.g. because it is not a triangle mesh.
+ */
+core::SharedMeshData optimizeMesh(const core::MeshData& mesh, size_t cacheSize = DEFAULT_VERTEX_CACHE_SIZE);
+
+// Fraction of the triangles kept by each level of detail relative to the previous one.
+constexpr double LOD_TRIANGLE_RATIO = 0.5;
+
+/**
+ * Return a simplified copy of a triangle mesh with about triangleRatio times the triangles of each submesh,
+ * using quadric error metric edge collapses onto existing vertices.
+ * Open borders are preserved, so meshes consisting of many small disconnected pieces may not reach the target.
+ * Returns nullptr if the mesh can't be simplified, e.g. because it has no vertex positions.
+ */
+core::SharedMeshData simplifyMesh(const core::MeshData& mesh, double triangleRatio);
+
+/**
+ * Return a copy of the mesh with the vertex attributes rounded to the precision of compact encodings:
+ * - texture coordinates to half floats,
+ * - normals, tangents and bitangents to 2x16 bit octahedral encoding,
+ * - colors to normalized bytes if all components are in [0, 1].
+ * The data is still stored as 32 bit floats since these are the only vertex formats Ramses supports,
+ * but texture coordinates and colors compress much better in exported scenes and more vertices can be merged by optimizeMesh.
+ * Positions are not changed.
+ */
+core::SharedMeshData quantizeAttributes(const core::MeshData& mesh);
+
+// Apply the level of detail simplification, quantization and optimization requested by the descriptor to a freshly imported mesh.
+core::SharedMeshData postProcessMesh(core::SharedMeshData mesh, const core::MeshDescriptor& descriptor);
+
+}  // namespace raco::mesh_loader
@@ -0,0 +1,57 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include <assimp/matrix3x3.h>
+#include <assimp/matrix4x4.h>
+#include <assimp/mesh.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace raco::mesh_loader {
+
+// Conversion kernels used by glTFMesh to write Assimp data into the final vertex and index buffers.
+// The kernels are vectorized with SSE2 or AVX2 on x86 processors; the instruction set is chosen at runtime.
+namespace vertex_conversion {
+
+enum class SimdLevel {
+	Scalar = 0,
+	SSE2,
+	AVX2
+};
+
+// Best instruction set supported by the processor and the build.
+SimdLevel supportedSimdLevel();
+
+// Instruction set used by the kernels, supportedSimdLevel() by default.
+SimdLevel simdLevel();
+// Override the instruction set, e.g. for comparisons in tests; clamped to supportedSimdLevel().
+void setSimdLevel(SimdLevel level);
+
+// Copy vectors with 3 or 4 components; these are plain memory copies since Assimp stores single precision floats.
+void copyVec3(const aiVector3D* source, size_t count, float* destination);
+void copyColors(const aiColor4D* source, size_t count, float* destination);
+
+// Copy the x and y components of each vector, as used for 2-component texture coordinates.
+void copyVec3ToVec2(const aiVector3D* source, size_t count, float* destination);
+
+// Apply the affine transformation to each point.
+void transformPoints(const aiMatrix4x4& transformation, const aiVector3D* source, size_t count, float* destination);
+
+// Apply the (normal) transformation to each direction and normalize the result; zero-length vectors are kept.
+void transformDirections(const aiMatrix3x3& transformation, const aiVector3D* source, size_t count, float* destination);
+
+// Write the indices of all faces, shifted by the offset, and return the number of indices written.
+size_t flattenFaceIndices(const aiFace* faces, size_t count, uint32_t offset, uint32_t* destination);
+
+}  // namespace vertex_conversion
+
+}  // namespace raco::mesh_loader
@@ -30,20 +30,21 @@ public:
 	int getTotalMeshCount(bool bakeAllSubmeshes) override;
 	std::string getError() override;
 	void reset() override;
+	size_t memoryUsage() const override;
 
 
 private:
 	std::string path_;
-	std::unique_ptr<Assimp::Importer> bakedSceneImporter_;
-	std::unique_ptr<Assimp::Importer> unbakedSceneImporter_;
-	const aiScene* bakedScene_{nullptr};
+	// Shared by baked and per-submesh loading, so that the file is only parsed once.
+	std::unique_ptr<Assimp::Importer> importer_;
+	const aiScene* scene_{nullptr};
 	raco::core::MeshScenegraph bakedScenegraph_;
-	const aiScene* unbakedScene_{nullptr};
 	raco::core::MeshScenegraph unbakedScenegraph_;
 	std::string error_;
 
 	bool buildglTFScenegraph(std::vector<core::MeshScenegraphNode>& sceneGraph, int parentIndex, aiNode* child);
-	bool importglTFScene(const core::MeshDescriptor& descriptor, std::unique_ptr<Assimp::Importer>& importer, const aiScene* &scene, raco::core::MeshScenegraph &sceneGraph, unsigned flags);
+	bool importglTFScene(const std::string& absPath);
+	bool buildScenegraph(const std::string& absPath, bool bakeAllSubmeshes);
 
 
 };
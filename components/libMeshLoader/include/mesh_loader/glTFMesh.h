@@ -28,7 +28,7 @@ public:
 
 	std::vector<std::string> getMaterialNames() const override;
 
-	const std::vector<uint32_t>& getIndices() const override;
+	core::SharedBuffer<uint32_t> getIndices() const override;
 
 	const std::vector<IndexBufferRangeInfo>& submeshIndexBufferRanges() const override;
 
@@ -49,7 +49,7 @@ private:
 	uint32_t numTriangles_;
 	uint32_t numVertices_;
 
-	std::vector<uint32_t> indexBuffer_;
+	core::SharedBuffer<uint32_t> indexBuffer_;
 	std::vector<Attribute> attributes_;
 	std::vector<IndexBufferRangeInfo> submeshIndexBufferRanges_;
 
@@ -10,6 +10,7 @@
 #include "mesh_loader/CTMFileLoader.h"
 
 #include "mesh_loader/CTMMesh.h"
+#include "mesh_loader/MeshOptimizer.h"
 
 #include <openctmpp.h>
 
@@ -66,7 +67,7 @@ int CTMFileLoader::getTotalMeshCount(bool bakeAllSubmeshes) {
 
 bool CTMFileLoader::loadFile() {
 	if (!importer_) {
-		importer_ = std::make_unique<CTMimporter>();
+		importer_ = std::make_shared<CTMimporter>();
 		try {
 			importer_->Load(path_.c_str());
 			valid_ = true;
@@ -82,11 +83,16 @@ bool CTMFileLoader::loadFile() {
 
 raco::core::SharedMeshData CTMFileLoader::loadMesh(const raco::core::MeshDescriptor& descriptor) {
 	if (loadFile()) {
-		return std::make_shared<CTMMesh>(*importer_.get());
+		return postProcessMesh(std::make_shared<CTMMesh>(importer_), descriptor);
 	}
 	return raco::core::SharedMeshData();
 }
 
+size_t CTMFileLoader::memoryUsage() const {
+	// The importer arrays are used directly by the CTMMesh and accounted for in its MeshData::memoryUsage.
+	return 0;
+}
+
 std::string CTMFileLoader::getError() {
 	return error_;
 }
@@ -15,43 +15,44 @@ namespace raco::mesh_loader {
 
 using namespace raco::core;
 
-CTMMesh::CTMMesh(CTMimporter& importer) {
-	numTriangles_ = importer.GetInteger(CTM_TRIANGLE_COUNT);
-	numVertices_ = importer.GetInteger(CTM_VERTEX_COUNT);
+CTMMesh::CTMMesh(std::shared_ptr<CTMimporter> importer) {
+	numTriangles_ = importer->GetInteger(CTM_TRIANGLE_COUNT);
+	numVertices_ = importer->GetInteger(CTM_VERTEX_COUNT);
 
-	auto indices = importer.GetIntegerArray(CTM_INDICES);
-	indexBuffer_ = std::vector<uint32_t>(indices, indices + 3 * numTriangles_);
+	static_assert(sizeof(CTMuint) == sizeof(uint32_t));
+	auto indices = importer->GetIntegerArray(CTM_INDICES);
+	indexBuffer_ = SharedBuffer<uint32_t>(importer, reinterpret_cast<const uint32_t*>(indices), 3 * numTriangles_);
 
-	auto vertices = importer.GetFloatArray(CTM_VERTICES);
+	auto vertices = importer->GetFloatArray(CTM_VERTICES);
 	attributes_.emplace_back(Attribute{
 		ATTRIBUTE_POSITION,
 		VertexAttribDataType::VAT_Float3,
-		std::vector<float>(vertices, vertices + 3 * numVertices_)});
+		SharedBuffer<float>(importer, vertices, 3 * numVertices_)});
 
-	if (importer.GetInteger(CTM_HAS_NORMALS) == CTM_TRUE) {
-		auto normals = importer.GetFloatArray(CTM_NORMALS);
+	if (importer->GetInteger(CTM_HAS_NORMALS) == CTM_TRUE) {
+		auto normals = importer->GetFloatArray(CTM_NORMALS);
 		attributes_.emplace_back(Attribute{
 			ATTRIBUTE_NORMAL,
 			VertexAttribDataType::VAT_Float3,
-			std::vector<float>(normals, normals + 3 * numVertices_)});
+			SharedBuffer<float>(importer, normals, 3 * numVertices_)});
 	}
 
-	for (unsigned i = 0; i < importer.GetInteger(CTM_UV_MAP_COUNT); i++) {
+	for (unsigned i = 0; i < importer->GetInteger(CTM_UV_MAP_COUNT); i++) {
 		CTMenum mapIndex = CTMenum(CTM_UV_MAP_1 + i);
-		auto array = importer.GetFloatArray(mapIndex);
+		auto array = importer->GetFloatArray(mapIndex);
 		attributes_.emplace_back(Attribute{
-			importer.GetUVMapString(mapIndex, CTM_NAME),
+			importer->GetUVMapString(mapIndex, CTM_NAME),
 			VertexAttribDataType::VAT_Float2,
-			std::vector<float>(array, array + 2 * numVertices_)});
+			SharedBuffer<float>(importer, array, 2 * numVertices_)});
 	}
 
-	for (unsigned i = 0; i < importer.GetInteger(CTM_ATTRIB_MAP_COUNT); i++) {
+	for (unsigned i = 0; i < importer->GetInteger(CTM_ATTRIB_MAP_COUNT); i++) {
 		CTMenum mapIndex = CTMenum(CTM_ATTRIB_MAP_1 + i);
-		auto array = importer.GetFloatArray(mapIndex);
+		auto array = importer->GetFloatArray(mapIndex);
 		attributes_.emplace_back(Attribute{
-			importer.GetAttribMapString(mapIndex, CTM_NAME),
+			importer->GetAttribMapString(mapIndex, CTM_NAME),
 			VertexAttribDataType::VAT_Float4,
-			std::vector<float>(array, array + 4 * numVertices_)});
+			SharedBuffer<float>(importer, array, 4 * numVertices_)});
 	}
 
 	submeshIndexBufferRanges_ = {{0, 3 * numTriangles_}};
@@ -73,7 +74,7 @@ std::vector<std::string> CTMMesh::getMaterialNames() const {
 	return {"material"};
 }
 
-const std::vector<uint32_t>& CTMMesh::getIndices() const {
+SharedBuffer<uint32_t> CTMMesh::getIndices() const {
 	return indexBuffer_;
 }
 
@@ -0,0 +1,73 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "mesh_loader/DiskCachedFileLoader.h"
+
+#include "mesh_loader/MeshDiskCache.h"
+
+namespace raco::mesh_loader {
+
+DiskCachedFileLoader::DiskCachedFileLoader(std::string absPath, raco::core::UniqueMeshCacheEntry loader) : path_(absPath), loader_(std::move(loader)) {
+}
+
+raco::core::SharedMeshData DiskCachedFileLoader::loadMesh(const raco::core::MeshDescriptor& descriptor) {
+	auto& diskCache = MeshDiskCache::instance();
+	if (!diskCache.enabled()) {
+		return loader_->loadMesh(descriptor);
+	}
+
+	if (!fileKey_) {
+		fileKey_ = MeshDiskCache::fileKey(path_);
+	}
+	if (fileKey_) {
+		if (auto record = diskCache.load(*fileKey_, descriptor)) {
+			cachedFileInfo_[descriptor.bakeAllSubmeshes] = {std::move(record->scenegraph), record->totalMeshCount};
+			return record->mesh;
+		}
+	}
+
+	auto mesh = loader_->loadMesh(descriptor);
+	cachedFileInfo_.erase(descriptor.bakeAllSubmeshes);
+	if (mesh && fileKey_) {
+		diskCache.store(*fileKey_, descriptor, *mesh, loader_->getScenegraph(descriptor.bakeAllSubmeshes), loader_->getTotalMeshCount(descriptor.bakeAllSubmeshes));
+	}
+	return mesh;
+}
+
+std::string DiskCachedFileLoader::getError() {
+	return loader_->getError();
+}
+
+void DiskCachedFileLoader::reset() {
+	fileKey_.reset();
+	cachedFileInfo_.clear();
+	loader_->reset();
+}
+
+raco::core::MeshScenegraph DiskCachedFileLoader::getScenegraph(bool bakeAllSubmeshes) {
+	auto it = cachedFileInfo_.find(bakeAllSubmeshes);
+	if (it != cachedFileInfo_.end()) {
+		return it->second.scenegraph;
+	}
+	return loader_->getScenegraph(bakeAllSubmeshes);
+}
+
+int DiskCachedFileLoader::getTotalMeshCount(bool bakeAllSubmeshes) {
+	auto it = cachedFileInfo_.find(bakeAllSubmeshes);
+	if (it != cachedFileInfo_.end()) {
+		return it->second.totalMeshCount;
+	}
+	return loader_->getTotalMeshCount(bakeAllSubmeshes);
+}
+
+size_t DiskCachedFileLoader::memoryUsage() const {
+	return loader_->memoryUsage();
+}
+
+}  // namespace raco::mesh_loader
@@ -0,0 +1,606 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "mesh_loader/MeshDiskCache.h"
+
+#include "log_system/log.h"
+#include "utils/stdfilesystem.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QUrl>
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+namespace raco::mesh_loader {
+
+namespace {
+
+constexpr char recordMagic[8] = {'R', 'A', 'C', 'O', 'M', 'E', 'S', 'H'};
+constexpr uint32_t recordVersion = 2;
+// Part of every file key. Increase it when changes to the import or conversion code change the resulting meshes, so
+// that records written by older versions are not reused.
+constexpr uint32_t pipelineVersion = 1;
+// Offsets of all buffers in a record are aligned so that they can be used in place from the mapping.
+constexpr size_t bufferAlignment = 16;
+
+void fnv1a(uint64_t& hash, const void* data, size_t size) {
+	auto bytes = static_cast<const unsigned char*>(data);
+	for (size_t i = 0; i < size; i++) {
+		hash ^= bytes[i];
+		hash *= 1099511628211ULL;
+	}
+}
+
+// Map a file and add its size and content to the hash. 'data' is null for empty files and stays valid while the file
+// is open. Returns false if the file can't be read.
+bool hashFile(uint64_t& hash, QFile& file, const uchar*& data) {
+	data = nullptr;
+	if (!file.open(QIODevice::ReadOnly)) {
+		return false;
+	}
+	auto size = static_cast<uint64_t>(file.size());
+	fnv1a(hash, &size, sizeof(size));
+	if (size == 0) {
+		return true;
+	}
+	data = file.map(0, file.size());
+	if (!data) {
+		return false;
+	}
+	fnv1a(hash, data, size);
+	return true;
+}
+
+// JSON part of a glTF file: the whole content of .gltf files or the first chunk of .glb files.
+QByteArray gltfJson(const QFileInfo& info, const uchar* data, size_t size) {
+	auto suffix = info.suffix().toLower();
+	if (suffix == "gltf") {
+		return QByteArray(reinterpret_cast<const char*>(data), static_cast<int>(size));
+	}
+	if (suffix == "glb") {
+		// 12 byte header followed by the JSON chunk: chunk length, chunk type, chunk data.
+		constexpr uint32_t glbMagic = 0x46546C67;
+		constexpr uint32_t jsonChunkType = 0x4E4F534A;
+		constexpr size_t jsonChunkOffset = 20;
+		uint32_t magic, chunkLength, chunkType;
+		if (size < jsonChunkOffset) {
+			return {};
+		}
+		std::memcpy(&magic, data, sizeof(magic));
+		std::memcpy(&chunkLength, data + 12, sizeof(chunkLength));
+		std::memcpy(&chunkType, data + 16, sizeof(chunkType));
+		if (magic != glbMagic || chunkType != jsonChunkType || chunkLength > size - jsonChunkOffset) {
+			return {};
+		}
+		return QByteArray(reinterpret_cast<const char*>(data + jsonChunkOffset), static_cast<int>(chunkLength));
+	}
+	return {};
+}
+
+// Add the external files referenced by the buffers and images of a glTF file to the hash.
+void hashReferencedFiles(uint64_t& hash, const QDir& folder, const QByteArray& json) {
+	const auto document = QJsonDocument::fromJson(json).object();
+	for (const auto& key : {"buffers", "images"}) {
+		for (const auto& entry : document.value(key).toArray()) {
+			auto uri = entry.toObject().value("uri").toString();
+			// Embedded data is part of the JSON, which is hashed already.
+			if (uri.isEmpty() || uri.startsWith("data:")) {
+				continue;
+			}
+			auto relativePath = QUrl::fromPercentEncoding(uri.toUtf8()).toStdString();
+			fnv1a(hash, relativePath.data(), relativePath.size());
+			QFile file(folder.filePath(QString::fromStdString(relativePath)));
+			const uchar* data;
+			if (!hashFile(hash, file, data)) {
+				constexpr uint64_t missing = ~0ULL;
+				fnv1a(hash, &missing, sizeof(missing));
+			}
+		}
+	}
+}
+
+class RecordWriter {
+public:
+	template <typename T>
+	void write(T value) {
+		stream_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	void write(const std::string& text) {
+		write<uint32_t>(static_cast<uint32_t>(text.size()));
+		writeBytes(text.data(), text.size());
+	}
+
+	void writeBytes(const char* data, size_t size) {
+		stream_.write(data, size);
+	}
+
+	void writeBuffer(const char* data, uint32_t size) {
+		write<uint32_t>(size);
+		auto pos = static_cast<size_t>(stream_.tellp());
+		static const char padding[bufferAlignment] = {};
+		stream_.write(padding, (bufferAlignment - pos % bufferAlignment) % bufferAlignment);
+		stream_.write(data, size);
+	}
+
+	std::string str() const {
+		return stream_.str();
+	}
+
+private:
+	std::ostringstream stream_;
+};
+
+class RecordReader {
+public:
+	RecordReader(const uchar* data, size_t size) : data_(data), size_(size) {}
+
+	template <typename T>
+	bool read(T& value) {
+		if (pos_ + sizeof(T) > size_) {
+			return false;
+		}
+		std::memcpy(&value, data_ + pos_, sizeof(T));
+		pos_ += sizeof(T);
+		return true;
+	}
+
+	bool read(std::string& text) {
+		uint32_t length;
+		if (!read(length) || pos_ + length > size_) {
+			return false;
+		}
+		text.assign(reinterpret_cast<const char*>(data_ + pos_), length);
+		pos_ += length;
+		return true;
+	}
+
+	// Return a pointer into the data instead of copying the buffer.
+	bool readBuffer(const char*& buffer, uint32_t& size) {
+		if (!read(size)) {
+			return false;
+		}
+		pos_ += (bufferAlignment - pos_ % bufferAlignment) % bufferAlignment;
+		if (pos_ + size > size_) {
+			return false;
+		}
+		buffer = reinterpret_cast<const char*>(data_ + pos_);
+		pos_ += size;
+		return true;
+	}
+
+private:
+	const uchar* data_;
+	size_t size_;
+	size_t pos_{0};
+};
+
+// MeshData of a memory-mapped cache record.
+class MappedMesh : public core::MeshData {
+public:
+	struct Attribute {
+		std::string name;
+		VertexAttribDataType type;
+		uint32_t elementCount;
+		uint32_t dataSize;
+		const char* data;
+	};
+
+	explicit MappedMesh(std::shared_ptr<QFile> file) : file_(std::move(file)) {}
+
+	uint32_t numSubmeshes() const override {
+		return numSubmeshes_;
+	}
+	uint32_t numTriangles() const override {
+		return numTriangles_;
+	}
+	uint32_t numVertices() const override {
+		return numVertices_;
+	}
+	uint32_t numFullDetailTriangles() const override {
+		return numFullDetailTriangles_;
+	}
+	std::vector<std::string> getMaterialNames() const override {
+		return materials_;
+	}
+	core::SharedBuffer<uint32_t> getIndices() const override {
+		return indices_;
+	}
+	const std::vector<IndexBufferRangeInfo>& submeshIndexBufferRanges() const override {
+		return submeshIndexBufferRanges_;
+	}
+	uint32_t numAttributes() const override {
+		return static_cast<uint32_t>(attributes_.size());
+	}
+	std::string attribName(int attribIndex) const override {
+		return attributes_.at(attribIndex).name;
+	}
+	uint32_t attribDataSize(int attribIndex) const override {
+		return attributes_.at(attribIndex).dataSize;
+	}
+	uint32_t attribElementCount(int attribIndex) const override {
+		return attributes_.at(attribIndex).elementCount;
+	}
+	VertexAttribDataType attribDataType(int attribIndex) const override {
+		return attributes_.at(attribIndex).type;
+	}
+	const char* attribBuffer(int attribIndex) const override {
+		return attributes_.at(attribIndex).data;
+	}
+
+	// Owns the mapping, which is released when the file is destroyed.
+	std::shared_ptr<QFile> file_;
+	uint32_t numSubmeshes_{0};
+	uint32_t numTriangles_{0};
+	uint32_t numVertices_{0};
+	uint32_t numFullDetailTriangles_{0};
+	std::vector<std::string> materials_;
+	core::SharedBuffer<uint32_t> indices_;
+	std::vector<IndexBufferRangeInfo> submeshIndexBufferRanges_;
+	std::vector<Attribute> attributes_;
+};
+
+// Number of float components of a serialized VertexAttribDataType; 0 if the value is no valid type.
+uint32_t componentCount(uint32_t type) {
+	switch (static_cast<core::MeshData::VertexAttribDataType>(type)) {
+		case core::MeshData::VertexAttribDataType::VAT_Float:
+			return 1;
+		case core::MeshData::VertexAttribDataType::VAT_Float2:
+			return 2;
+		case core::MeshData::VertexAttribDataType::VAT_Float3:
+			return 3;
+		case core::MeshData::VertexAttribDataType::VAT_Float4:
+			return 4;
+		default:
+			return 0;
+	}
+}
+
+void writeScenegraph(RecordWriter& writer, const core::MeshScenegraph& scenegraph) {
+	writer.write<uint32_t>(static_cast<uint32_t>(scenegraph.nodes.size()));
+	for (const auto& node : scenegraph.nodes) {
+		writer.write<int32_t>(node.parentIndex);
+		writer.write<uint32_t>(static_cast<uint32_t>(node.subMeshIndeces.size()));
+		for (auto index : node.subMeshIndeces) {
+			writer.write<uint32_t>(index);
+		}
+		writer.write(node.name);
+		for (const auto& vector : {node.transformations.scale, node.transformations.rotation, node.transformations.translation}) {
+			for (auto component : vector) {
+				writer.write<double>(component);
+			}
+		}
+	}
+	for (const auto* names : {&scenegraph.materials, &scenegraph.meshes}) {
+		writer.write<uint32_t>(static_cast<uint32_t>(names->size()));
+		for (const auto& name : *names) {
+			writer.write(name);
+		}
+	}
+}
+
+bool readScenegraph(RecordReader& reader, core::MeshScenegraph& scenegraph) {
+	uint32_t numNodes;
+	if (!reader.read(numNodes)) {
+		return false;
+	}
+	for (uint32_t i = 0; i < numNodes; i++) {
+		auto& node = scenegraph.nodes.emplace_back();
+		uint32_t numSubmeshes;
+		if (!reader.read(node.parentIndex) || !reader.read(numSubmeshes)) {
+			return false;
+		}
+		node.subMeshIndeces.resize(numSubmeshes);
+		for (auto& index : node.subMeshIndeces) {
+			if (!reader.read(index)) {
+				return false;
+			}
+		}
+		if (!reader.read(node.name)) {
+			return false;
+		}
+		for (auto* vector : {&node.transformations.scale, &node.transformations.rotation, &node.transformations.translation}) {
+			for (auto& component : *vector) {
+				if (!reader.read(component)) {
+					return false;
+				}
+			}
+		}
+	}
+	for (auto* names : {&scenegraph.materials, &scenegraph.meshes}) {
+		uint32_t numNames;
+		if (!reader.read(numNames)) {
+			return false;
+		}
+		names->resize(numNames);
+		for (auto& name : *names) {
+			if (!reader.read(name)) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+}  // namespace
+
+MeshDiskCache& MeshDiskCache::instance() {
+	static MeshDiskCache cache;
+	return cache;
+}
+
+void MeshDiskCache::setCacheDirectory(const std::string& directory) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	directory_ = directory;
+	if (!directory_.empty()) {
+		std::error_code ec;
+		std::filesystem::create_directories(directory_, ec);
+		if (ec) {
+			LOG_WARNING(log_system::MESH_LOADER, "Can't create mesh cache directory {}: {}", directory_, ec.message());
+			directory_.clear();
+		} else {
+			prune();
+		}
+	}
+}
+
+bool MeshDiskCache::enabled() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return !directory_.empty();
+}
+
+void MeshDiskCache::setSizeLimit(uint64_t bytes) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	sizeLimit_ = bytes;
+	if (!directory_.empty()) {
+		prune();
+	}
+}
+
+void MeshDiskCache::prune() {
+	struct CacheFile {
+		std::filesystem::path path;
+		std::filesystem::file_time_type time;
+		uint64_t size;
+	};
+	std::vector<CacheFile> files;
+	uint64_t totalSize = 0;
+	std::error_code ec;
+	for (const auto& entry : std::filesystem::directory_iterator(directory_, ec)) {
+		if (entry.is_regular_file(ec)) {
+			CacheFile file{entry.path(), entry.last_write_time(ec), static_cast<uint64_t>(entry.file_size(ec))};
+			if (!ec) {
+				totalSize += file.size;
+				files.emplace_back(file);
+			}
+		}
+	}
+	if (totalSize <= sizeLimit_) {
+		return;
+	}
+
+	std::sort(files.begin(), files.end(), [](const CacheFile& left, const CacheFile& right) {
+		return left.time < right.time;
+	});
+	for (const auto& file : files) {
+		if (totalSize <= sizeLimit_) {
+			break;
+		}
+		// Removal fails for records which are still mapped on some platforms; they are pruned later.
+		if (std::filesystem::remove(file.path, ec)) {
+			totalSize -= file.size;
+			LOG_DEBUG(log_system::MESH_LOADER, "Pruned mesh cache record {}", file.path.string());
+		}
+	}
+}
+
+std::optional<uint64_t> MeshDiskCache::fileKey(const std::string& absPath) {
+	QFile file(QString::fromStdString(absPath));
+	uint64_t hash = 14695981039346656037ULL;
+	fnv1a(hash, &pipelineVersion, sizeof(pipelineVersion));
+	const uchar* data;
+	if (!hashFile(hash, file, data)) {
+		return std::nullopt;
+	}
+
+	QFileInfo info(file);
+	if (data) {
+		auto json = gltfJson(info, data, static_cast<size_t>(file.size()));
+		if (!json.isEmpty()) {
+			hashReferencedFiles(hash, info.dir(), json);
+		}
+	}
+	return hash;
+}
+
+std::string MeshDiskCache::recordPath(uint64_t fileKey, const core::MeshDescriptor& descriptor) const {
+	auto name = fmt::format("{:016x}_{}{}{}{}.racomesh", fileKey, descriptor.bakeAllSubmeshes ? std::string("baked") : std::to_string(descriptor.submeshIndex),
+		descriptor.lodLevel > 0 ? fmt::format("_lod{}", descriptor.lodLevel) : std::string(), descriptor.quantizeAttributes ? "_quantized" : "", descriptor.optimizeMesh ? "_optimized" : "");
+	return (std::filesystem::path(directory_) / name).string();
+}
+
+std::optional<MeshDiskCache::Record> MeshDiskCache::load(uint64_t fileKey, const core::MeshDescriptor& descriptor) {
+	std::string path;
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (directory_.empty()) {
+			return std::nullopt;
+		}
+		path = recordPath(fileKey, descriptor);
+	}
+
+	auto file = std::make_shared<QFile>(QString::fromStdString(path));
+	if (!file->open(QIODevice::ReadOnly)) {
+		++missCount_;
+		return std::nullopt;
+	}
+	auto size = static_cast<size_t>(file->size());
+	const uchar* data = file->map(0, file->size());
+	if (!data) {
+		++missCount_;
+		return std::nullopt;
+	}
+
+	RecordReader reader(data, size);
+	Record record;
+	auto mesh = std::make_shared<MappedMesh>(file);
+	auto parse = [&]() {
+		char magic[sizeof(recordMagic)];
+		uint32_t version;
+		if (!reader.read(magic) || std::memcmp(magic, recordMagic, sizeof(recordMagic)) != 0 || !reader.read(version) || version != recordVersion) {
+			return false;
+		}
+		uint32_t numMaterials, numRanges, numAttributes;
+		if (!reader.read(record.totalMeshCount) || !reader.read(mesh->numSubmeshes_) || !reader.read(mesh->numTriangles_) || !reader.read(mesh->numVertices_) || !reader.read(mesh->numFullDetailTriangles_) || !reader.read(numMaterials)) {
+			return false;
+		}
+		mesh->materials_.resize(numMaterials);
+		for (auto& material : mesh->materials_) {
+			if (!reader.read(material)) {
+				return false;
+			}
+		}
+		if (!reader.read(numRanges)) {
+			return false;
+		}
+		mesh->submeshIndexBufferRanges_.resize(numRanges);
+		for (auto& range : mesh->submeshIndexBufferRanges_) {
+			if (!reader.read(range.start) || !reader.read(range.count)) {
+				return false;
+			}
+		}
+		if (!readScenegraph(reader, record.scenegraph)) {
+			return false;
+		}
+		const char* indices;
+		uint32_t indicesSize;
+		if (!reader.readBuffer(indices, indicesSize)) {
+			return false;
+		}
+		// The buffers are used in place and passed to Ramses, so a record whose layout doesn't match its counts is rejected
+		// instead of letting readers run past the buffers.
+		if (indicesSize % sizeof(uint32_t) != 0) {
+			return false;
+		}
+		mesh->indices_ = core::SharedBuffer<uint32_t>(file, reinterpret_cast<const uint32_t*>(indices), indicesSize / sizeof(uint32_t));
+		for (auto index : mesh->indices_) {
+			if (index >= mesh->numVertices_) {
+				return false;
+			}
+		}
+		for (const auto& range : mesh->submeshIndexBufferRanges_) {
+			if (static_cast<uint64_t>(range.start) + range.count > mesh->indices_.size()) {
+				return false;
+			}
+		}
+		if (!reader.read(numAttributes)) {
+			return false;
+		}
+		mesh->attributes_.resize(numAttributes);
+		for (auto& attribute : mesh->attributes_) {
+			uint32_t type;
+			if (!reader.read(attribute.name) || !reader.read(type) || !reader.read(attribute.elementCount) || !reader.readBuffer(attribute.data, attribute.dataSize)) {
+				return false;
+			}
+			auto components = componentCount(type);
+			if (components == 0 || attribute.elementCount != mesh->numVertices_ || attribute.dataSize != static_cast<uint64_t>(attribute.elementCount) * components * sizeof(float)) {
+				return false;
+			}
+			attribute.type = static_cast<core::MeshData::VertexAttribDataType>(type);
+		}
+		return true;
+	};
+
+	if (!parse()) {
+		LOG_WARNING(log_system::MESH_LOADER, "Ignoring invalid mesh cache record {}", path);
+		++missCount_;
+		return std::nullopt;
+	}
+
+	LOG_DEBUG(log_system::MESH_LOADER, "Loaded mesh from cache record {}", path);
+	// The modification time orders the records for pruning.
+	std::error_code ec;
+	std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+	++hitCount_;
+	record.mesh = mesh;
+	return record;
+}
+
+void MeshDiskCache::store(uint64_t fileKey, const core::MeshDescriptor& descriptor, const core::MeshData& mesh, const core::MeshScenegraph& scenegraph, int totalMeshCount) {
+	std::string path;
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (directory_.empty()) {
+			return;
+		}
+		path = recordPath(fileKey, descriptor);
+	}
+
+	// load() rejects records whose attributes don't have one element per vertex.
+	for (uint32_t i = 0; i < mesh.numAttributes(); i++) {
+		if (mesh.attribElementCount(i) != mesh.numVertices()) {
+			LOG_DEBUG(log_system::MESH_LOADER, "Not caching mesh {}: attribute '{}' has {} elements for {} vertices", path, mesh.attribName(i), mesh.attribElementCount(i), mesh.numVertices());
+			return;
+		}
+	}
+
+	RecordWriter writer;
+	writer.writeBytes(recordMagic, sizeof(recordMagic));
+	writer.write<uint32_t>(recordVersion);
+	writer.write<int32_t>(totalMeshCount);
+	writer.write<uint32_t>(mesh.numSubmeshes());
+	writer.write<uint32_t>(mesh.numTriangles());
+	writer.write<uint32_t>(mesh.numVertices());
+	writer.write<uint32_t>(mesh.numFullDetailTriangles());
+	auto materials = mesh.getMaterialNames();
+	writer.write<uint32_t>(static_cast<uint32_t>(materials.size()));
+	for (const auto& material : materials) {
+		writer.write(material);
+	}
+	writer.write<uint32_t>(static_cast<uint32_t>(mesh.submeshIndexBufferRanges().size()));
+	for (const auto& range : mesh.submeshIndexBufferRanges()) {
+		writer.write<uint32_t>(range.start);
+		writer.write<uint32_t>(range.count);
+	}
+	writeScenegraph(writer, scenegraph);
+	auto indices = mesh.getIndices();
+	writer.writeBuffer(reinterpret_cast<const char*>(indices.data()), static_cast<uint32_t>(indices.size() * sizeof(uint32_t)));
+	writer.write<uint32_t>(mesh.numAttributes());
+	for (uint32_t i = 0; i < mesh.numAttributes(); i++) {
+		writer.write(mesh.attribName(i));
+		writer.write<uint32_t>(static_cast<uint32_t>(mesh.attribDataType(i)));
+		writer.write<uint32_t>(mesh.attribElementCount(i));
+		writer.writeBuffer(mesh.attribBuffer(i), mesh.attribDataSize(i));
+	}
+
+	// QSaveFile writes to a unique temporary file in the same directory first, so that concurrent readers never see
+	// partial records, even if several processes share the cache directory.
+	QSaveFile file(QString::fromStdString(path));
+	auto content = writer.str();
+	if (!file.open(QIODevice::WriteOnly) || file.write(content.data(), content.size()) != static_cast<qint64>(content.size()) || !file.commit()) {
+		LOG_WARNING(log_system::MESH_LOADER, "Can't write mesh cache record {}: {}", path, file.errorString().toStdString());
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (!directory_.empty()) {
+		prune();
+	}
+}
+
+}  // namespace raco::mesh_loader
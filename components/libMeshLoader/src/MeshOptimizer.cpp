@@ -0,0 +1,809 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "mesh_loader/MeshOptimizer.h"
+
+#include "log_system/log.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace raco::mesh_loader {
+
+using namespace raco::core;
+
+namespace {
+
+constexpr uint32_t NO_VERTEX = std::numeric_limits<uint32_t>::max();
+
+class OptimizedMesh : public MeshData {
+public:
+	struct Attribute {
+		std::string name;
+		VertexAttribDataType type;
+		uint32_t components;
+		std::vector<float> data;
+	};
+
+	uint32_t numSubmeshes() const override {
+		return static_cast<uint32_t>(submeshIndexBufferRanges_.size());
+	}
+	uint32_t numTriangles() const override {
+		return static_cast<uint32_t>(indices_.size() / 3);
+	}
+	uint32_t numVertices() const override {
+		return numVertices_;
+	}
+	uint32_t numFullDetailTriangles() const override {
+		return fullDetailTriangles_;
+	}
+	std::vector<std::string> getMaterialNames() const override {
+		return materials_;
+	}
+	SharedBuffer<uint32_t> getIndices() const override {
+		return indices_;
+	}
+	const std::vector<IndexBufferRangeInfo>& submeshIndexBufferRanges() const override {
+		return submeshIndexBufferRanges_;
+	}
+	uint32_t numAttributes() const override {
+		return static_cast<uint32_t>(attributes_.size());
+	}
+	std::string attribName(int attribIndex) const override {
+		return attributes_.at(attribIndex).name;
+	}
+	uint32_t attribDataSize(int attribIndex) const override {
+		return static_cast<uint32_t>(attributes_.at(attribIndex).data.size() * sizeof(float));
+	}
+	uint32_t attribElementCount(int attribIndex) const override {
+		return numVertices_;
+	}
+	VertexAttribDataType attribDataType(int attribIndex) const override {
+		return attributes_.at(attribIndex).type;
+	}
+	const char* attribBuffer(int attribIndex) const override {
+		return reinterpret_cast<const char*>(attributes_.at(attribIndex).data.data());
+	}
+
+	uint32_t numVertices_{0};
+	uint32_t fullDetailTriangles_{0};
+	std::vector<std::string> materials_;
+	SharedBuffer<uint32_t> indices_;
+	std::vector<IndexBufferRangeInfo> submeshIndexBufferRanges_;
+	std::vector<Attribute> attributes_;
+};
+
+uint32_t componentCount(MeshData::VertexAttribDataType type) {
+	switch (type) {
+		case MeshData::VertexAttribDataType::VAT_Float2:
+			return 2;
+		case MeshData::VertexAttribDataType::VAT_Float3:
+			return 3;
+		case MeshData::VertexAttribDataType::VAT_Float4:
+			return 4;
+		default:
+			return 1;
+	}
+}
+
+struct AttributeSource {
+	const float* data;
+	uint32_t components;
+};
+
+// Map every vertex to the first vertex with identical data in all attributes.
+std::vector<uint32_t> findDuplicateVertices(const std::vector<AttributeSource>& attributes, uint32_t numVertices) {
+	auto hashVertex = [&attributes](uint32_t vertex) {
+		uint64_t hash = 14695981039346656037ULL;
+		for (const auto& attribute : attributes) {
+			auto bytes = reinterpret_cast<const unsigned char*>(attribute.data + static_cast<size_t>(vertex) * attribute.components);
+			for (size_t i = 0; i < attribute.components * sizeof(float); i++) {
+				hash ^= bytes[i];
+				hash *= 1099511628211ULL;
+			}
+		}
+		return hash;
+	};
+	auto equalVertices = [&attributes](uint32_t first, uint32_t second) {
+		return std::all_of(attributes.begin(), attributes.end(), [first, second](const AttributeSource& attribute) {
+			return std::memcmp(attribute.data + static_cast<size_t>(first) * attribute.components, attribute.data + static_cast<size_t>(second) * attribute.components, attribute.components * sizeof(float)) == 0;
+		});
+	};
+
+	std::vector<uint32_t> canonical(numVertices);
+	// Vertices with the same hash are chained, starting with the most recently added one.
+	std::vector<uint32_t> nextWithSameHash(numVertices, NO_VERTEX);
+	std::unordered_map<uint64_t, uint32_t> chains;
+	chains.reserve(numVertices);
+	for (uint32_t vertex = 0; vertex < numVertices; vertex++) {
+		auto [it, inserted] = chains.emplace(hashVertex(vertex), vertex);
+		canonical[vertex] = vertex;
+		if (!inserted) {
+			uint32_t candidate = it->second;
+			for (; candidate != NO_VERTEX; candidate = nextWithSameHash[candidate]) {
+				if (equalVertices(candidate, vertex)) {
+					canonical[vertex] = candidate;
+					break;
+				}
+			}
+			if (candidate == NO_VERTEX) {
+				nextWithSameHash[vertex] = it->second;
+				it->second = vertex;
+			}
+		}
+	}
+	return canonical;
+}
+
+// Read the attributes of a triangle mesh as float arrays.
+// Returns false if the mesh can't be processed, i.e. if it is not a triangle mesh with one element per vertex in every attribute.
+bool collectAttributes(const MeshData& mesh, const char* operation, std::vector<AttributeSource>& attributes, const float*& positions) {
+	const uint32_t numVertices = mesh.numVertices();
+	if (mesh.getIndices().size() % 3 != 0 || numVertices == 0) {
+		LOG_WARNING(log_system::MESH_LOADER, "Mesh {} skipped: not a triangle mesh", operation);
+		return false;
+	}
+	for (uint32_t i = 0; i < mesh.numAttributes(); i++) {
+		if (mesh.attribElementCount(i) != numVertices) {
+			LOG_WARNING(log_system::MESH_LOADER, "Mesh {} skipped: attribute '{}' has {} elements for {} vertices", operation, mesh.attribName(i), mesh.attribElementCount(i), numVertices);
+			return false;
+		}
+		attributes.emplace_back(AttributeSource{reinterpret_cast<const float*>(mesh.attribBuffer(i)), componentCount(mesh.attribDataType(i))});
+		if (mesh.attribName(i) == MeshData::ATTRIBUTE_POSITION && mesh.attribDataType(i) == MeshData::VertexAttribDataType::VAT_Float3) {
+			positions = attributes.back().data;
+		}
+	}
+	return true;
+}
+
+// Build a mesh from the given triangles of the source mesh.
+// Unused vertices are dropped and the remaining vertices are numbered in order of first use.
+std::shared_ptr<OptimizedMesh> buildCompactMesh(const MeshData& mesh, const std::vector<AttributeSource>& attributes, std::vector<uint32_t> indices, std::vector<MeshData::IndexBufferRangeInfo> ranges) {
+	std::vector<uint32_t> newIndex(mesh.numVertices(), NO_VERTEX);
+	std::vector<uint32_t> sourceVertex;
+	for (auto& index : indices) {
+		if (newIndex[index] == NO_VERTEX) {
+			newIndex[index] = static_cast<uint32_t>(sourceVertex.size());
+			sourceVertex.emplace_back(index);
+		}
+		index = newIndex[index];
+	}
+
+	auto result = std::make_shared<OptimizedMesh>();
+	result->numVertices_ = static_cast<uint32_t>(sourceVertex.size());
+	result->fullDetailTriangles_ = mesh.numFullDetailTriangles();
+	result->materials_ = mesh.getMaterialNames();
+	result->submeshIndexBufferRanges_ = std::move(ranges);
+	for (uint32_t i = 0; i < mesh.numAttributes(); i++) {
+		const auto& source = attributes[i];
+		std::vector<float> data(sourceVertex.size() * source.components);
+		for (size_t vertex = 0; vertex < sourceVertex.size(); vertex++) {
+			std::memcpy(data.data() + vertex * source.components, source.data + static_cast<size_t>(sourceVertex[vertex]) * source.components, source.components * sizeof(float));
+		}
+		result->attributes_.emplace_back(OptimizedMesh::Attribute{mesh.attribName(i), mesh.attribDataType(i), source.components, std::move(data)});
+	}
+	result->indices_ = SharedBuffer<uint32_t>(std::move(indices));
+	return result;
+}
+
+// Triangles using each vertex in compressed form.
+// If nodes are given, the triangles are collected per node instead of per vertex.
+struct Adjacency {
+	Adjacency(const uint32_t* indices, size_t indexCount, size_t numVertices, const uint32_t* nodes = nullptr) : offsets(numVertices + 1, 0), triangles(indexCount) {
+		auto key = [indices, nodes](size_t i) {
+			return nodes ? nodes[indices[i]] : indices[i];
+		};
+		for (size_t i = 0; i < indexCount; i++) {
+			offsets[key(i) + 1]++;
+		}
+		for (size_t vertex = 0; vertex < numVertices; vertex++) {
+			offsets[vertex + 1] += offsets[vertex];
+		}
+		std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+		for (size_t i = 0; i < indexCount; i++) {
+			triangles[fill[key(i)]++] = static_cast<uint32_t>(i / 3);
+		}
+	}
+
+	size_t count(uint32_t vertex) const {
+		return offsets[vertex + 1] - offsets[vertex];
+	}
+	const uint32_t* begin(uint32_t vertex) const {
+		return triangles.data() + offsets[vertex];
+	}
+	const uint32_t* end(uint32_t vertex) const {
+		return triangles.data() + offsets[vertex + 1];
+	}
+
+	std::vector<size_t> offsets;
+	std::vector<uint32_t> triangles;
+};
+
+// Tipsify: reorder the triangles for a post-transform vertex cache of the given size.
+// Returns the reordered indices; clusterStarts receives the first triangle of each cluster ended by a dead end.
+std::vector<uint32_t> tipsify(const uint32_t* indices, size_t indexCount, uint32_t numVertices, size_t cacheSize, std::vector<size_t>& clusterStarts) {
+	const size_t numTriangles = indexCount / 3;
+
+	Adjacency adjacency(indices, indexCount, numVertices);
+	std::vector<uint32_t> liveTriangles(numVertices);
+	for (uint32_t vertex = 0; vertex < numVertices; vertex++) {
+		liveTriangles[vertex] = static_cast<uint32_t>(adjacency.count(vertex));
+	}
+
+	std::vector<int64_t> cacheTime(numVertices, 0);
+	std::vector<bool> emitted(numTriangles, false);
+	std::vector<uint32_t> deadEnd;
+	std::vector<uint32_t> candidates;
+	std::vector<uint32_t> output;
+	output.reserve(indexCount);
+	const auto cacheSizeInt = static_cast<int64_t>(cacheSize);
+	int64_t time = cacheSizeInt + 1;
+	uint32_t cursor = 0;
+
+	auto skipDeadEnd = [&]() {
+		while (!deadEnd.empty()) {
+			auto vertex = deadEnd.back();
+			deadEnd.pop_back();
+			if (liveTriangles[vertex] > 0) {
+				return vertex;
+			}
+		}
+		for (; cursor < numVertices; cursor++) {
+			if (liveTriangles[cursor] > 0) {
+				return cursor;
+			}
+		}
+		return NO_VERTEX;
+	};
+
+	clusterStarts = {0};
+	uint32_t fanning = numTriangles > 0 ? indices[0] : NO_VERTEX;
+	while (fanning != NO_VERTEX) {
+		candidates.clear();
+		for (auto it = adjacency.begin(fanning); it != adjacency.end(fanning); ++it) {
+			auto triangle = *it;
+			if (!emitted[triangle]) {
+				for (size_t corner = 0; corner < 3; corner++) {
+					auto vertex = indices[3 * static_cast<size_t>(triangle) + corner];
+					output.emplace_back(vertex);
+					deadEnd.emplace_back(vertex);
+					candidates.emplace_back(vertex);
+					liveTriangles[vertex]--;
+					if (time - cacheTime[vertex] > cacheSizeInt) {
+						cacheTime[vertex] = time++;
+					}
+				}
+				emitted[triangle] = true;
+			}
+		}
+
+		// Prefer the vertex which is oldest in the cache but will still be in the cache after fanning around it.
+		uint32_t next = NO_VERTEX;
+		int64_t bestPriority = -1;
+		for (auto vertex : candidates) {
+			if (liveTriangles[vertex] > 0) {
+				int64_t priority = 0;
+				if (time - cacheTime[vertex] + 2 * static_cast<int64_t>(liveTriangles[vertex]) <= cacheSizeInt) {
+					priority = time - cacheTime[vertex];
+				}
+				if (priority > bestPriority) {
+					bestPriority = priority;
+					next = vertex;
+				}
+			}
+		}
+		if (next == NO_VERTEX) {
+			next = skipDeadEnd();
+			if (next != NO_VERTEX) {
+				clusterStarts.emplace_back(output.size() / 3);
+			}
+		}
+		fanning = next;
+	}
+	return output;
+}
+
+using Vec3 = std::array<double, 3>;
+
+Vec3 subtract(const Vec3& a, const Vec3& b) {
+	return {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+}
+
+Vec3 cross(const Vec3& a, const Vec3& b) {
+	return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+}
+
+double dot(const Vec3& a, const Vec3& b) {
+	return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+Vec3 vertexPosition(const float* positions, uint32_t vertex) {
+	auto p = positions + 3 * static_cast<size_t>(vertex);
+	return {p[0], p[1], p[2]};
+}
+
+// Sort the clusters so that clusters likely to occlude others are drawn first.
+void sortClustersForOverdraw(std::vector<uint32_t>& indices, const std::vector<size_t>& clusterStarts, const float* positions) {
+	if (clusterStarts.size() < 2) {
+		return;
+	}
+	auto position = [positions](uint32_t vertex) {
+		return vertexPosition(positions, vertex);
+	};
+
+	struct Cluster {
+		size_t start;
+		size_t end;
+		Vec3 centroid;
+		// Area weighted normal.
+		Vec3 normal;
+		double area;
+		double occlusionPotential;
+	};
+	std::vector<Cluster> clusters;
+	Vec3 meshCentroid{0, 0, 0};
+	double meshArea = 0;
+	const size_t numTriangles = indices.size() / 3;
+	for (size_t c = 0; c < clusterStarts.size(); c++) {
+		Cluster cluster{clusterStarts[c], c + 1 < clusterStarts.size() ? clusterStarts[c + 1] : numTriangles, {0, 0, 0}, {0, 0, 0}, 0, 0};
+		for (size_t triangle = cluster.start; triangle < cluster.end; triangle++) {
+			auto p0 = position(indices[3 * triangle]);
+			auto p1 = position(indices[3 * triangle + 1]);
+			auto p2 = position(indices[3 * triangle + 2]);
+			auto normal = cross(subtract(p1, p0), subtract(p2, p0));
+			double area = std::sqrt(dot(normal, normal)) / 2;
+			for (int i = 0; i < 3; i++) {
+				cluster.centroid[i] += area * (p0[i] + p1[i] + p2[i]) / 3;
+				cluster.normal[i] += normal[i];
+			}
+			cluster.area += area;
+		}
+		for (int i = 0; i < 3; i++) {
+			meshCentroid[i] += cluster.centroid[i];
+		}
+		meshArea += cluster.area;
+		if (cluster.area > 0) {
+			for (auto& component : cluster.centroid) {
+				component /= cluster.area;
+			}
+		}
+		clusters.emplace_back(cluster);
+	}
+	if (meshArea <= 0) {
+		return;
+	}
+	for (auto& component : meshCentroid) {
+		component /= meshArea;
+	}
+
+	for (auto& cluster : clusters) {
+		double normalLength = std::sqrt(dot(cluster.normal, cluster.normal));
+		cluster.occlusionPotential = normalLength > 0 ? dot(subtract(cluster.centroid, meshCentroid), cluster.normal) / normalLength : 0;
+	}
+	std::stable_sort(clusters.begin(), clusters.end(), [](const Cluster& first, const Cluster& second) {
+		return first.occlusionPotential > second.occlusionPotential;
+	});
+
+	std::vector<uint32_t> sorted;
+	sorted.reserve(indices.size());
+	for (const auto& cluster : clusters) {
+		sorted.insert(sorted.end(), indices.begin() + 3 * cluster.start, indices.begin() + 3 * cluster.end);
+	}
+	indices = std::move(sorted);
+}
+
+// Error quadric (Garland, Heckbert: "Surface Simplification Using Quadric Error Metrics", 1997):
+// weighted sum of the squared distances of a point to a set of planes.
+struct Quadric {
+	// Upper triangle of the symmetric 4x4 matrix.
+	std::array<double, 10> q{};
+
+	static Quadric plane(const Vec3& normal, double distance, double weight) {
+		auto [a, b, c] = normal;
+		auto d = distance;
+		return {{weight * a * a, weight * a * b, weight * a * c, weight * a * d, weight * b * b, weight * b * c, weight * b * d, weight * c * c, weight * c * d, weight * d * d}};
+	}
+
+	Quadric& operator+=(const Quadric& other) {
+		for (size_t i = 0; i < q.size(); i++) {
+			q[i] += other.q[i];
+		}
+		return *this;
+	}
+
+	double error(const Vec3& point) const {
+		auto [x, y, z] = point;
+		return q[0] * x * x + 2 * q[1] * x * y + 2 * q[2] * x * z + 2 * q[3] * x + q[4] * y * y + 2 * q[5] * y * z + 2 * q[6] * y + q[7] * z * z + 2 * q[8] * z + q[9];
+	}
+};
+
+// Quadric edge collapse simplification of a triangle list down to about targetTriangles triangles.
+// The surface topology is given by the nodes: vertices with the same position, e.g. on texture seams, belong to the same node.
+// A collapse moves all vertices of a node onto a neighboring node; no new vertices are created, so the vertex attributes stay valid.
+// Nodes on open or non-manifold edges are never moved to keep the silhouette and avoid holes.
+std::vector<uint32_t> simplifyTriangles(std::vector<uint32_t> indices, size_t targetTriangles, const float* positions, const std::vector<uint32_t>& node) {
+	const auto numVertices = static_cast<uint32_t>(node.size());
+	auto position = [positions](uint32_t vertex) {
+		return vertexPosition(positions, vertex);
+	};
+	auto isDegenerate = [&node](const uint32_t* triangle) {
+		return node[triangle[0]] == node[triangle[1]] || node[triangle[1]] == node[triangle[2]] || node[triangle[2]] == node[triangle[0]];
+	};
+
+	std::vector<uint32_t> remaining;
+	for (size_t triangle = 0; triangle < indices.size() / 3; triangle++) {
+		if (!isDegenerate(&indices[3 * triangle])) {
+			remaining.insert(remaining.end(), indices.begin() + 3 * triangle, indices.begin() + 3 * triangle + 3);
+		}
+	}
+	indices = std::move(remaining);
+
+	std::vector<Quadric> quadrics(numVertices);
+	for (size_t triangle = 0; triangle < indices.size() / 3; triangle++) {
+		auto p0 = position(indices[3 * triangle]);
+		auto normal = cross(subtract(position(indices[3 * triangle + 1]), p0), subtract(position(indices[3 * triangle + 2]), p0));
+		double length = std::sqrt(dot(normal, normal));
+		if (length > 0) {
+			Vec3 unitNormal{normal[0] / length, normal[1] / length, normal[2] / length};
+			auto quadric = Quadric::plane(unitNormal, -dot(unitNormal, p0), length / 2);
+			for (size_t corner = 0; corner < 3; corner++) {
+				quadrics[node[indices[3 * triangle + corner]]] += quadric;
+			}
+		}
+	}
+
+	struct Collapse {
+		double cost;
+		uint32_t from;
+		uint32_t to;
+	};
+	std::vector<Collapse> collapses;
+	std::vector<uint64_t> edges;
+	std::vector<bool> locked(numVertices);
+	std::vector<bool> touched(numVertices);
+	std::vector<uint32_t> vertexRemap(numVertices);
+
+	// Collapses are done in passes of independent collapses, i.e. no two collapses of a pass share a triangle.
+	while (indices.size() / 3 > targetTriangles) {
+		const size_t numTriangles = indices.size() / 3;
+		Adjacency adjacency(indices.data(), indices.size(), numVertices, node.data());
+
+		edges.clear();
+		for (size_t i = 0; i < indices.size(); i++) {
+			uint64_t a = node[indices[i]];
+			uint64_t b = node[indices[i % 3 == 2 ? i - 2 : i + 1]];
+			edges.emplace_back(std::min(a, b) << 32 | std::max(a, b));
+		}
+		std::sort(edges.begin(), edges.end());
+		locked.assign(numVertices, false);
+		for (size_t first = 0, last = 0; first < edges.size(); first = last) {
+			while (last < edges.size() && edges[last] == edges[first]) {
+				last++;
+			}
+			if (last - first != 2) {
+				locked[edges[first] >> 32] = true;
+				locked[edges[first] & 0xffffffff] = true;
+			}
+		}
+
+		collapses.clear();
+		for (size_t i = 0; i < indices.size(); i++) {
+			auto from = node[indices[i]];
+			auto to = node[indices[i % 3 == 2 ? i - 2 : i + 1]];
+			for (auto [a, b] : {std::make_pair(from, to), std::make_pair(to, from)}) {
+				if (!locked[a]) {
+					auto quadric = quadrics[a];
+					quadric += quadrics[b];
+					collapses.emplace_back(Collapse{quadric.error(position(b)), a, b});
+				}
+			}
+		}
+		std::sort(collapses.begin(), collapses.end(), [](const Collapse& first, const Collapse& second) {
+			return first.cost < second.cost;
+		});
+
+		// Moving the node must not flip any of the remaining triangles around it.
+		auto flipsTriangles = [&](uint32_t from, uint32_t to) {
+			auto target = position(to);
+			for (auto it = adjacency.begin(from); it != adjacency.end(from); ++it) {
+				const uint32_t* triangle = &indices[3 * static_cast<size_t>(*it)];
+				if (node[triangle[0]] == to || node[triangle[1]] == to || node[triangle[2]] == to) {
+					continue;
+				}
+				std::array<Vec3, 3> corners{position(triangle[0]), position(triangle[1]), position(triangle[2])};
+				auto before = cross(subtract(corners[1], corners[0]), subtract(corners[2], corners[0]));
+				for (size_t corner = 0; corner < 3; corner++) {
+					if (node[triangle[corner]] == from) {
+						corners[corner] = target;
+					}
+				}
+				auto after = cross(subtract(corners[1], corners[0]), subtract(corners[2], corners[0]));
+				if (dot(before, after) <= 0) {
+					return true;
+				}
+			}
+			return false;
+		};
+
+		touched.assign(numVertices, false);
+		vertexRemap.assign(numVertices, NO_VERTEX);
+		size_t removedTriangles = 0;
+		for (const auto& collapse : collapses) {
+			if (removedTriangles >= numTriangles - targetTriangles) {
+				break;
+			}
+			if (touched[collapse.from] || touched[collapse.to] || flipsTriangles(collapse.from, collapse.to)) {
+				continue;
+			}
+			// Prefer moving a vertex to a vertex it shares an edge with, so that attributes are continuous across seams.
+			for (auto it = adjacency.begin(collapse.from); it != adjacency.end(collapse.from); ++it) {
+				const uint32_t* triangle = &indices[3 * static_cast<size_t>(*it)];
+				auto toCorner = std::find_if(triangle, triangle + 3, [&](uint32_t vertex) { return node[vertex] == collapse.to; });
+				if (toCorner != triangle + 3) {
+					removedTriangles++;
+					for (size_t corner = 0; corner < 3; corner++) {
+						if (node[triangle[corner]] == collapse.from && vertexRemap[triangle[corner]] == NO_VERTEX) {
+							vertexRemap[triangle[corner]] = *toCorner;
+						}
+					}
+				}
+			}
+			for (auto it = adjacency.begin(collapse.from); it != adjacency.end(collapse.from); ++it) {
+				const uint32_t* triangle = &indices[3 * static_cast<size_t>(*it)];
+				for (size_t corner = 0; corner < 3; corner++) {
+					if (node[triangle[corner]] == collapse.from && vertexRemap[triangle[corner]] == NO_VERTEX) {
+						vertexRemap[triangle[corner]] = collapse.to;
+					}
+					touched[node[triangle[corner]]] = true;
+				}
+			}
+			quadrics[collapse.to] += quadrics[collapse.from];
+		}
+		if (removedTriangles == 0) {
+			break;
+		}
+
+		remaining.clear();
+		for (size_t triangle = 0; triangle < numTriangles; triangle++) {
+			std::array<uint32_t, 3> corners;
+			for (size_t corner = 0; corner < 3; corner++) {
+				auto vertex = indices[3 * triangle + corner];
+				corners[corner] = vertexRemap[vertex] != NO_VERTEX ? vertexRemap[vertex] : vertex;
+			}
+			if (!isDegenerate(corners.data())) {
+				remaining.insert(remaining.end(), corners.begin(), corners.end());
+			}
+		}
+		indices.swap(remaining);
+	}
+	return indices;
+}
+
+bool hasPrefix(const std::string& name, const char* prefix) {
+	return name.rfind(prefix, 0) == 0;
+}
+
+// Round to the nearest value representable as IEEE 754 half float; values beyond the half float range are clamped.
+float roundToHalfPrecision(float value) {
+	constexpr float maxHalf = 65504.0f;
+	constexpr float minNormalHalf = 1.0f / 16384.0f;
+	if (std::isnan(value)) {
+		return value;
+	}
+	if (std::abs(value) >= maxHalf) {
+		return std::copysign(maxHalf, value);
+	}
+	if (std::abs(value) < minNormalHalf) {
+		// Subnormal half floats are multiples of 2^-24.
+		return std::nearbyint(value * 16777216.0f) / 16777216.0f;
+	}
+	uint32_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	// Round the 23 bit mantissa to 10 bits, ties to even.
+	bits += 0x00000fff + ((bits >> 13) & 1);
+	bits &= ~0x00001fffU;
+	std::memcpy(&value, &bits, sizeof(bits));
+	return std::abs(value) > maxHalf ? std::copysign(maxHalf, value) : value;
+}
+
+float roundToNormalized(float value, float steps) {
+	return std::nearbyint(value * steps) / steps;
+}
+
+// Round a direction to the precision of a 2x16 bit signed normalized octahedral encoding.
+// (Cigolle et al.: "A Survey of Efficient Representations for Independent Unit Vectors", 2014)
+void roundToOctahedral16(float* direction) {
+	auto signNotZero = [](float value) {
+		return value < 0.0f ? -1.0f : 1.0f;
+	};
+	float l1Norm = std::abs(direction[0]) + std::abs(direction[1]) + std::abs(direction[2]);
+	if (l1Norm == 0.0f || !std::isfinite(l1Norm)) {
+		return;
+	}
+	float u = direction[0] / l1Norm;
+	float v = direction[1] / l1Norm;
+	if (direction[2] < 0.0f) {
+		float foldedU = (1.0f - std::abs(v)) * signNotZero(u);
+		v = (1.0f - std::abs(u)) * signNotZero(v);
+		u = foldedU;
+	}
+	u = roundToNormalized(u, 32767.0f);
+	v = roundToNormalized(v, 32767.0f);
+
+	float z = 1.0f - std::abs(u) - std::abs(v);
+	if (z < 0.0f) {
+		float unfoldedU = (1.0f - std::abs(v)) * signNotZero(u);
+		v = (1.0f - std::abs(u)) * signNotZero(v);
+		u = unfoldedU;
+	}
+	float length = std::sqrt(u * u + v * v + z * z);
+	direction[0] = u / length;
+	direction[1] = v / length;
+	direction[2] = z / length;
+}
+
+// Round the attribute data to the precision of its compact encoding; returns false if the attribute is kept as is.
+bool quantizeAttribute(const std::string& name, MeshData::VertexAttribDataType type, std::vector<float>& data) {
+	using VAT = MeshData::VertexAttribDataType;
+	if (hasPrefix(name, MeshData::ATTRIBUTE_UVMAP)) {
+		for (auto& value : data) {
+			value = roundToHalfPrecision(value);
+		}
+		return true;
+	}
+	if ((name == MeshData::ATTRIBUTE_NORMAL || name == MeshData::ATTRIBUTE_TANGENT || name == MeshData::ATTRIBUTE_BITANGENT) && (type == VAT::VAT_Float3 || type == VAT::VAT_Float4)) {
+		// The w component of 4 component tangents is the handedness sign and is kept.
+		auto components = componentCount(type);
+		for (size_t offset = 0; offset + components <= data.size(); offset += components) {
+			roundToOctahedral16(&data[offset]);
+		}
+		return true;
+	}
+	if (hasPrefix(name, MeshData::ATTRIBUTE_COLOR)) {
+		// Only colors in [0, 1] can be stored as normalized bytes.
+		if (!std::all_of(data.begin(), data.end(), [](float value) { return value >= 0.0f && value <= 1.0f; })) {
+			return false;
+		}
+		for (auto& value : data) {
+			value = roundToNormalized(value, 255.0f);
+		}
+		return true;
+	}
+	return false;
+}
+
+}  // namespace
+
+double averageCacheMissRatio(const uint32_t* indices, size_t indexCount, size_t cacheSize) {
+	if (indexCount < 3) {
+		return 0.0;
+	}
+	uint32_t maxIndex = *std::max_element(indices, indices + indexCount);
+	// With a FIFO cache, a vertex is cached if less than cacheSize misses happened since it was inserted.
+	std::vector<int64_t> insertedAt(static_cast<size_t>(maxIndex) + 1, std::numeric_limits<int64_t>::min() / 2);
+	int64_t misses = 0;
+	for (size_t i = 0; i < indexCount; i++) {
+		if (misses - insertedAt[indices[i]] >= static_cast<int64_t>(cacheSize)) {
+			insertedAt[indices[i]] = misses++;
+		}
+	}
+	return static_cast<double>(misses) / static_cast<double>(indexCount / 3);
+}
+
+SharedMeshData optimizeMesh(const MeshData& mesh, size_t cacheSize) {
+	std::vector<AttributeSource> attributes;
+	const float* positions = nullptr;
+	if (!collectAttributes(mesh, "optimization", attributes, positions)) {
+		return nullptr;
+	}
+	const uint32_t numVertices = mesh.numVertices();
+	auto sourceIndices = mesh.getIndices();
+
+	auto canonical = findDuplicateVertices(attributes, numVertices);
+	std::vector<uint32_t> dedupedIndices(sourceIndices.size());
+	for (size_t i = 0; i < sourceIndices.size(); i++) {
+		dedupedIndices[i] = canonical[sourceIndices[i]];
+	}
+
+	// Triangles are only reordered within their submesh.
+	std::vector<uint32_t> indices;
+	indices.reserve(dedupedIndices.size());
+	for (const auto& range : mesh.submeshIndexBufferRanges()) {
+		std::vector<size_t> clusterStarts;
+		auto reordered = tipsify(dedupedIndices.data() + range.start, range.count, numVertices, cacheSize, clusterStarts);
+		if (positions) {
+			sortClustersForOverdraw(reordered, clusterStarts, positions);
+		}
+		indices.insert(indices.end(), reordered.begin(), reordered.end());
+	}
+
+	auto result = buildCompactMesh(mesh, attributes, std::move(indices), mesh.submeshIndexBufferRanges());
+	LOG_DEBUG(log_system::MESH_LOADER, "Optimized mesh: {} -> {} vertices, ACMR {:.3f} -> {:.3f}", numVertices, result->numVertices(),
+		averageCacheMissRatio(sourceIndices.data(), sourceIndices.size(), cacheSize), averageCacheMissRatio(result->getIndices().data(), result->getIndices().size(), cacheSize));
+	return result;
+}
+
+SharedMeshData simplifyMesh(const MeshData& mesh, double triangleRatio) {
+	std::vector<AttributeSource> attributes;
+	const float* positions = nullptr;
+	if (!collectAttributes(mesh, "simplification", attributes, positions)) {
+		return nullptr;
+	}
+	if (!positions) {
+		LOG_WARNING(log_system::MESH_LOADER, "Mesh simplification skipped: mesh has no vertex positions");
+		return nullptr;
+	}
+	const uint32_t numVertices = mesh.numVertices();
+	auto sourceIndices = mesh.getIndices();
+	auto node = findDuplicateVertices({AttributeSource{positions, 3}}, numVertices);
+
+	std::vector<uint32_t> indices;
+	std::vector<MeshData::IndexBufferRangeInfo> ranges;
+	for (const auto& range : mesh.submeshIndexBufferRanges()) {
+		size_t targetTriangles = std::max<size_t>(1, static_cast<size_t>(triangleRatio * (range.count / 3)));
+		auto simplified = simplifyTriangles(std::vector<uint32_t>(sourceIndices.begin() + range.start, sourceIndices.begin() + range.start + range.count), targetTriangles, positions, node);
+		ranges.emplace_back(MeshData::IndexBufferRangeInfo{static_cast<uint32_t>(indices.size()), static_cast<uint32_t>(simplified.size())});
+		indices.insert(indices.end(), simplified.begin(), simplified.end());
+	}
+
+	auto result = buildCompactMesh(mesh, attributes, std::move(indices), std::move(ranges));
+	LOG_DEBUG(log_system::MESH_LOADER, "Simplified mesh: {} -> {} triangles", mesh.numTriangles(), result->numTriangles());
+	return result;
+}
+
+SharedMeshData quantizeAttributes(const MeshData& mesh) {
+	std::vector<AttributeSource> attributes;
+	const float* positions = nullptr;
+	if (!collectAttributes(mesh, "quantization", attributes, positions)) {
+		return nullptr;
+	}
+	// Vertices and indices are kept as they are.
+	auto result = std::make_shared<OptimizedMesh>();
+	result->numVertices_ = mesh.numVertices();
+	result->fullDetailTriangles_ = mesh.numFullDetailTriangles();
+	result->materials_ = mesh.getMaterialNames();
+	result->submeshIndexBufferRanges_ = mesh.submeshIndexBufferRanges();
+	result->indices_ = mesh.getIndices();
+	for (uint32_t i = 0; i < mesh.numAttributes(); i++) {
+		const auto& source = attributes[i];
+		OptimizedMesh::Attribute attribute{mesh.attribName(i), mesh.attribDataType(i), source.components, std::vector<float>(source.data, source.data + static_cast<size_t>(mesh.numVertices()) * source.components)};
+		if (quantizeAttribute(attribute.name, attribute.type, attribute.data)) {
+			LOG_DEBUG(log_system::MESH_LOADER, "Quantized mesh attribute '{}'", attribute.name);
+		}
+		result->attributes_.emplace_back(std::move(attribute));
+	}
+	return result;
+}
+
+SharedMeshData postProcessMesh(SharedMeshData mesh, const MeshDescriptor& descriptor) {
+	if (mesh && descriptor.lodLevel > 0) {
+		if (auto simplified = simplifyMesh(*mesh, std::pow(LOD_TRIANGLE_RATIO, descriptor.lodLevel))) {
+			mesh = simplified;
+		}
+	}
+	if (mesh && descriptor.quantizeAttributes) {
+		if (auto quantized = quantizeAttributes(*mesh)) {
+			mesh = quantized;
+		}
+	}
+	if (mesh && descriptor.optimizeMesh) {
+		if (auto optimized = optimizeMesh(*mesh)) {
+			mesh = optimized;
+		}
+	}
+	return mesh;
+}
+
+}  // namespace raco::mesh_loader
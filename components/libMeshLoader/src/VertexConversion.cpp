@@ -0,0 +1,285 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "mesh_loader/VertexConversion.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define RACO_VERTEX_CONVERSION_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+// MSVC allows AVX2 intrinsics in any function.
+#define RACO_TARGET_AVX2
+#else
+#define RACO_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#endif
+#endif
+
+namespace raco::mesh_loader::vertex_conversion {
+
+static_assert(sizeof(aiVector3D) == 3 * sizeof(float), "Assimp must be built with single precision floats.");
+static_assert(sizeof(aiColor4D) == 4 * sizeof(float), "Assimp must be built with single precision floats.");
+
+namespace {
+
+// Scalar kernels: also used for the remaining elements of the vectorized kernels.
+
+void copyVec3ToVec2Scalar(const aiVector3D* source, size_t count, float* destination) {
+	for (size_t i = 0; i < count; ++i) {
+		destination[2 * i] = source[i].x;
+		destination[2 * i + 1] = source[i].y;
+	}
+}
+
+void transformPointsScalar(const aiMatrix4x4& m, const aiVector3D* source, size_t count, float* destination) {
+	for (size_t i = 0; i < count; ++i) {
+		const auto& v = source[i];
+		destination[3 * i] = m.a1 * v.x + m.a2 * v.y + m.a3 * v.z + m.a4;
+		destination[3 * i + 1] = m.b1 * v.x + m.b2 * v.y + m.b3 * v.z + m.b4;
+		destination[3 * i + 2] = m.c1 * v.x + m.c2 * v.y + m.c3 * v.z + m.c4;
+	}
+}
+
+void transformDirectionsScalar(const aiMatrix3x3& m, const aiVector3D* source, size_t count, float* destination) {
+	for (size_t i = 0; i < count; ++i) {
+		const auto& v = source[i];
+		float x = m.a1 * v.x + m.a2 * v.y + m.a3 * v.z;
+		float y = m.b1 * v.x + m.b2 * v.y + m.b3 * v.z;
+		float z = m.c1 * v.x + m.c2 * v.y + m.c3 * v.z;
+		float length = std::sqrt(x * x + y * y + z * z);
+		if (length > 0.0f) {
+			x /= length;
+			y /= length;
+			z /= length;
+		}
+		destination[3 * i] = x;
+		destination[3 * i + 1] = y;
+		destination[3 * i + 2] = z;
+	}
+}
+
+#if defined(RACO_VERTEX_CONVERSION_X86)
+
+// SSE2 is part of every x86-64 processor, so these kernels need no special target.
+
+void copyVec3ToVec2SSE2(const aiVector3D* source, size_t count, float* destination) {
+	const float* src = &source->x;
+	size_t i = 0;
+	// 4 vectors per iteration: (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3)
+	for (; i + 4 <= count; i += 4) {
+		__m128 a = _mm_loadu_ps(src + 3 * i);
+		__m128 b = _mm_loadu_ps(src + 3 * i + 4);
+		__m128 c = _mm_loadu_ps(src + 3 * i + 8);
+		__m128 x1y1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 3, 3));
+		_mm_storeu_ps(destination + 2 * i, _mm_shuffle_ps(a, x1y1, _MM_SHUFFLE(2, 0, 1, 0)));
+		_mm_storeu_ps(destination + 2 * i + 4, _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2)));
+	}
+	copyVec3ToVec2Scalar(source + i, count - i, destination + 2 * i);
+}
+
+void transformPointsSSE2(const aiMatrix4x4& m, const aiVector3D* source, size_t count, float* destination) {
+	const __m128 col0 = _mm_setr_ps(m.a1, m.b1, m.c1, 0.0f);
+	const __m128 col1 = _mm_setr_ps(m.a2, m.b2, m.c2, 0.0f);
+	const __m128 col2 = _mm_setr_ps(m.a3, m.b3, m.c3, 0.0f);
+	const __m128 col3 = _mm_setr_ps(m.a4, m.b4, m.c4, 0.0f);
+	size_t i = 0;
+	// The 4-wide store overwrites the first component of the next point, which is written in the next iteration.
+	for (; i + 1 < count; ++i) {
+		const auto& v = source[i];
+		__m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(v.x)), _mm_mul_ps(col1, _mm_set1_ps(v.y))),
+			_mm_add_ps(_mm_mul_ps(col2, _mm_set1_ps(v.z)), col3));
+		_mm_storeu_ps(destination + 3 * i, result);
+	}
+	transformPointsScalar(m, source + i, count - i, destination + 3 * i);
+}
+
+void transformDirectionsSSE2(const aiMatrix3x3& m, const aiVector3D* source, size_t count, float* destination) {
+	const __m128 col0 = _mm_setr_ps(m.a1, m.b1, m.c1, 0.0f);
+	const __m128 col1 = _mm_setr_ps(m.a2, m.b2, m.c2, 0.0f);
+	const __m128 col2 = _mm_setr_ps(m.a3, m.b3, m.c3, 0.0f);
+	const __m128 zero = _mm_setzero_ps();
+	size_t i = 0;
+	for (; i + 1 < count; ++i) {
+		const auto& v = source[i];
+		__m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(v.x)), _mm_mul_ps(col1, _mm_set1_ps(v.y))), _mm_mul_ps(col2, _mm_set1_ps(v.z)));
+		__m128 squared = _mm_mul_ps(result, result);
+		__m128 lengthSquared = _mm_add_ps(_mm_add_ps(_mm_shuffle_ps(squared, squared, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(squared, squared, _MM_SHUFFLE(1, 1, 1, 1))),
+			_mm_shuffle_ps(squared, squared, _MM_SHUFFLE(2, 2, 2, 2)));
+		__m128 length = _mm_sqrt_ps(lengthSquared);
+		// Keep zero-length vectors instead of dividing by zero.
+		__m128 nonZero = _mm_cmpgt_ps(length, zero);
+		__m128 normalized = _mm_div_ps(result, _mm_or_ps(_mm_and_ps(nonZero, length), _mm_andnot_ps(nonZero, _mm_set1_ps(1.0f))));
+		_mm_storeu_ps(destination + 3 * i, normalized);
+	}
+	transformDirectionsScalar(m, source + i, count - i, destination + 3 * i);
+}
+
+RACO_TARGET_AVX2 void copyVec3ToVec2AVX2(const aiVector3D* source, size_t count, float* destination) {
+	const float* src = &source->x;
+	// Gather x/y of 4 vectors from the floats 0..7 and 4..11 of the source.
+	const __m256i lowIndices = _mm256_setr_epi32(0, 1, 3, 4, 6, 7, 0, 0);
+	const __m256i highIndices = _mm256_setr_epi32(0, 0, 0, 0, 0, 0, 5, 6);
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m256 low = _mm256_permutevar8x32_ps(_mm256_loadu_ps(src + 3 * i), lowIndices);
+		__m256 high = _mm256_permutevar8x32_ps(_mm256_loadu_ps(src + 3 * i + 4), highIndices);
+		_mm256_storeu_ps(destination + 2 * i, _mm256_blend_ps(low, high, 0xC0));
+	}
+	copyVec3ToVec2Scalar(source + i, count - i, destination + 2 * i);
+}
+
+RACO_TARGET_AVX2 void transformPointsAVX2(const aiMatrix4x4& m, const aiVector3D* source, size_t count, float* destination) {
+	// Two points per iteration, one in each 128 bit lane.
+	const __m256 col0 = _mm256_setr_ps(m.a1, m.b1, m.c1, 0.0f, m.a1, m.b1, m.c1, 0.0f);
+	const __m256 col1 = _mm256_setr_ps(m.a2, m.b2, m.c2, 0.0f, m.a2, m.b2, m.c2, 0.0f);
+	const __m256 col2 = _mm256_setr_ps(m.a3, m.b3, m.c3, 0.0f, m.a3, m.b3, m.c3, 0.0f);
+	const __m256 col3 = _mm256_setr_ps(m.a4, m.b4, m.c4, 0.0f, m.a4, m.b4, m.c4, 0.0f);
+	size_t i = 0;
+	// The stores overlap like in the SSE2 kernel, so the last point is always written by the scalar kernel.
+	for (; i + 3 <= count; i += 2) {
+		const auto& v0 = source[i];
+		const auto& v1 = source[i + 1];
+		__m256 x = _mm256_setr_ps(v0.x, v0.x, v0.x, v0.x, v1.x, v1.x, v1.x, v1.x);
+		__m256 y = _mm256_setr_ps(v0.y, v0.y, v0.y, v0.y, v1.y, v1.y, v1.y, v1.y);
+		__m256 z = _mm256_setr_ps(v0.z, v0.z, v0.z, v0.z, v1.z, v1.z, v1.z, v1.z);
+		__m256 result = _mm256_fmadd_ps(col0, x, _mm256_fmadd_ps(col1, y, _mm256_fmadd_ps(col2, z, col3)));
+		_mm_storeu_ps(destination + 3 * i, _mm256_castps256_ps128(result));
+		_mm_storeu_ps(destination + 3 * i + 3, _mm256_extractf128_ps(result, 1));
+	}
+	transformPointsScalar(m, source + i, count - i, destination + 3 * i);
+}
+
+SimdLevel detectSimdLevel() {
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] >= 7) {
+		__cpuid(info, 1);
+		bool fma = (info[2] & (1 << 12)) != 0;
+		bool osxsave = (info[2] & (1 << 27)) != 0;
+		bool avx = (info[2] & (1 << 28)) != 0;
+		__cpuidex(info, 7, 0);
+		bool avx2 = (info[1] & (1 << 5)) != 0;
+		// The operating system has to save the AVX registers on context switches.
+		if (fma && osxsave && avx && avx2 && (_xgetbv(0) & 0x6) == 0x6) {
+			return SimdLevel::AVX2;
+		}
+	}
+	return SimdLevel::SSE2;
+#else
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+		return SimdLevel::AVX2;
+	}
+	return SimdLevel::SSE2;
+#endif
+}
+
+#else
+
+SimdLevel detectSimdLevel() {
+	return SimdLevel::Scalar;
+}
+
+#endif
+
+std::atomic<SimdLevel>& currentSimdLevel() {
+	static std::atomic<SimdLevel> level{supportedSimdLevel()};
+	return level;
+}
+
+}  // namespace
+
+SimdLevel supportedSimdLevel() {
+	static const SimdLevel supported = detectSimdLevel();
+	return supported;
+}
+
+SimdLevel simdLevel() {
+	return currentSimdLevel();
+}
+
+void setSimdLevel(SimdLevel level) {
+	currentSimdLevel() = std::min(level, supportedSimdLevel());
+}
+
+void copyVec3(const aiVector3D* source, size_t count, float* destination) {
+	std::memcpy(destination, source, count * sizeof(aiVector3D));
+}
+
+void copyColors(const aiColor4D* source, size_t count, float* destination) {
+	std::memcpy(destination, source, count * sizeof(aiColor4D));
+}
+
+void copyVec3ToVec2(const aiVector3D* source, size_t count, float* destination) {
+	switch (simdLevel()) {
+#if defined(RACO_VERTEX_CONVERSION_X86)
+		case SimdLevel::AVX2:
+			return copyVec3ToVec2AVX2(source, count, destination);
+		case SimdLevel::SSE2:
+			return copyVec3ToVec2SSE2(source, count, destination);
+#endif
+		default:
+			return copyVec3ToVec2Scalar(source, count, destination);
+	}
+}
+
+void transformPoints(const aiMatrix4x4& transformation, const aiVector3D* source, size_t count, float* destination) {
+	switch (simdLevel()) {
+#if defined(RACO_VERTEX_CONVERSION_X86)
+		case SimdLevel::AVX2:
+			return transformPointsAVX2(transformation, source, count, destination);
+		case SimdLevel::SSE2:
+			return transformPointsSSE2(transformation, source, count, destination);
+#endif
+		default:
+			return transformPointsScalar(transformation, source, count, destination);
+	}
+}
+
+void transformDirections(const aiMatrix3x3& transformation, const aiVector3D* source, size_t count, float* destination) {
+	switch (simdLevel()) {
+#if defined(RACO_VERTEX_CONVERSION_X86)
+		// The normalization dominates here, for which AVX2 brings no benefit over SSE2.
+		case SimdLevel::AVX2:
+		case SimdLevel::SSE2:
+			return transformDirectionsSSE2(transformation, source, count, destination);
+#endif
+		default:
+			return transformDirectionsScalar(transformation, source, count, destination);
+	}
+}
+
+size_t flattenFaceIndices(const aiFace* faces, size_t count, uint32_t offset, uint32_t* destination) {
+	// Every face has its own index array, so this is bound by the memory accesses rather than arithmetic:
+	// the triangle case is unrolled instead of vectorized.
+	uint32_t* out = destination;
+	for (size_t faceIndex = 0; faceIndex < count; ++faceIndex) {
+		const aiFace& face = faces[faceIndex];
+		const unsigned int* indices = face.mIndices;
+		if (face.mNumIndices == 3) {
+			out[0] = indices[0] + offset;
+			out[1] = indices[1] + offset;
+			out[2] = indices[2] + offset;
+			out += 3;
+		} else {
+			for (unsigned i = 0; i < face.mNumIndices; ++i) {
+				*out++ = indices[i] + offset;
+			}
+		}
+	}
+	return static_cast<size_t>(out - destination);
+}
+
+}  // namespace raco::mesh_loader::vertex_conversion
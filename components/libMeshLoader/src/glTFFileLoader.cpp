@@ -10,6 +10,7 @@
 #include "mesh_loader/glTFFileLoader.h"
 
 #include "mesh_loader/glTFMesh.h"
+#include "mesh_loader/MeshOptimizer.h"
 
 #include <cmath>
 #include <assimp/DefaultLogger.hpp>
@@ -66,8 +67,8 @@ glTFFileLoader::glTFFileLoader(std::string absPath) : path_(absPath) {
 
 void glTFFileLoader::reset() {
 	error_.clear();
-	bakedSceneImporter_.reset();
-	unbakedSceneImporter_.reset();
+	importer_.reset();
+	scene_ = nullptr;
 	bakedScenegraph_.clear();
 	unbakedScenegraph_.clear();
 }
@@ -115,35 +116,52 @@ bool glTFFileLoader::buildglTFScenegraph(std::vector<raco::core::MeshScenegraphN
 	return true;
 }
 
-bool glTFFileLoader::importglTFScene(const core::MeshDescriptor& descriptor, std::unique_ptr<Assimp::Importer>& importer, const aiScene*& scene, raco::core::MeshScenegraph& sceneGraph, unsigned flags) {
-	if (!importer) {
-		LOG_DEBUG(log_system::MESH_LOADER, "Create importer for: {}", descriptor.absPath);
-		importer = std::make_unique<Assimp::Importer>();
-		LOG_DEBUG(log_system::MESH_LOADER, "Import baked glTF scene: {}", descriptor.bakeAllSubmeshes);
-		scene = importer->ReadFile(descriptor.absPath.c_str(), flags);
+bool glTFFileLoader::importglTFScene(const std::string& absPath) {
+	if (!importer_) {
+		LOG_DEBUG(log_system::MESH_LOADER, "Create importer for: {}", absPath);
+		importer_ = std::make_unique<Assimp::Importer>();
+		// The scene is imported untransformed only once; baked meshes are derived from it by glTFMesh.
+		scene_ = importer_->ReadFile(absPath.c_str(), aiPostProcessSteps::aiProcess_Triangulate | aiPostProcessSteps::aiProcess_GenNormals);
 	}
 
-	if (scene == nullptr || scene->mNumMeshes < 1) {
-		error_ = importer->GetErrorString();
+	if (scene_ == nullptr || scene_->mNumMeshes < 1) {
+		error_ = importer_->GetErrorString();
 		if (error_.empty()) {
-			LOG_ERROR(log_system::MESH_LOADER, "Encountered an error while loading glTF mesh {}", descriptor.absPath);
+			LOG_ERROR(log_system::MESH_LOADER, "Encountered an error while loading glTF mesh {}", absPath);
 		} else {
-			LOG_ERROR(log_system::MESH_LOADER, "Encountered an error while loading glTF mesh {}\n\tError: {}", descriptor.absPath, error_);
+			LOG_ERROR(log_system::MESH_LOADER, "Encountered an error while loading glTF mesh {}\n\tError: {}", absPath, error_);
 		}
 
 		return false;
 	}
+	return true;
+}
 
+bool glTFFileLoader::buildScenegraph(const std::string& absPath, bool bakeAllSubmeshes) {
+	auto& sceneGraph = bakeAllSubmeshes ? bakedScenegraph_ : unbakedScenegraph_;
 	sceneGraph.clear();
-	for (unsigned meshIndex = 0; meshIndex < scene->mNumMeshes; ++meshIndex) {
-		sceneGraph.meshes.emplace_back(scene->mMeshes[meshIndex]->mName.C_Str());
+	for (unsigned meshIndex = 0; meshIndex < scene_->mNumMeshes; ++meshIndex) {
+		sceneGraph.meshes.emplace_back(scene_->mMeshes[meshIndex]->mName.C_Str());
 
-		auto meshMaterialIndex = scene->mMeshes[meshIndex]->mMaterialIndex;
-		sceneGraph.materials.emplace_back(scene->mMaterials[meshMaterialIndex]->GetName().C_Str());
+		auto meshMaterialIndex = scene_->mMeshes[meshIndex]->mMaterialIndex;
+		sceneGraph.materials.emplace_back(scene_->mMaterials[meshMaterialIndex]->GetName().C_Str());
+	}
+
+	if (bakeAllSubmeshes) {
+		// All node transformations are applied to the baked mesh, so only a single untransformed node remains.
+		auto& rootNode = sceneGraph.nodes.emplace_back();
+		rootNode.name = scene_->mRootNode->mName.data;
+		for (unsigned meshIndex = 0; meshIndex < scene_->mNumMeshes; ++meshIndex) {
+			rootNode.subMeshIndeces.emplace_back(meshIndex);
+		}
+		rootNode.transformations.scale = {1.0, 1.0, 1.0};
+		rootNode.transformations.rotation = {0.0, 0.0, 0.0};
+		rootNode.transformations.translation = {0.0, 0.0, 0.0};
+		return true;
 	}
 
-	if (!buildglTFScenegraph(sceneGraph.nodes, -1, scene->mRootNode)) {
-		LOG_ERROR(log_system::MESH_LOADER, "Encountered an error while loading glTF mesh {}\n\tError: {}", descriptor.absPath, error_);
+	if (!buildglTFScenegraph(sceneGraph.nodes, -1, scene_->mRootNode)) {
+		LOG_ERROR(log_system::MESH_LOADER, "Encountered an error while loading glTF mesh {}\n\tError: {}", absPath, error_);
 		sceneGraph.clear();
 		return false;
 	}
@@ -156,29 +174,30 @@ raco::core::MeshScenegraph glTFFileLoader::getScenegraph(bool bakeAllSubmeshes)
 }
 
 int glTFFileLoader::getTotalMeshCount(bool bakeAllSubmeshes) {
-	if (auto* sceneToCheck = bakeAllSubmeshes ? bakedScene_ : unbakedScene_) {
-		return static_cast<int>(sceneToCheck->mNumMeshes);
+	if (scene_) {
+		return static_cast<int>(scene_->mNumMeshes);
 	}
 	return 0;
 }
 
 raco::core::SharedMeshData glTFFileLoader::loadMesh(const core::MeshDescriptor& descriptor) {
-	auto &activeImporter = descriptor.bakeAllSubmeshes ? bakedSceneImporter_ : unbakedSceneImporter_;
-	auto &sceneToImport = descriptor.bakeAllSubmeshes ? bakedScene_ : unbakedScene_;
-	auto &sceneGraph = descriptor.bakeAllSubmeshes ? bakedScenegraph_ : unbakedScenegraph_;
-	auto activeFlags = aiPostProcessSteps::aiProcess_Triangulate | aiPostProcessSteps::aiProcess_GenNormals;
-	if (descriptor.bakeAllSubmeshes) {
-		activeFlags |= aiPostProcessSteps::aiProcess_PreTransformVertices;
-	}
-
-	if (!importglTFScene(descriptor, activeImporter, sceneToImport, sceneGraph, activeFlags)) {
+	if (!importglTFScene(descriptor.absPath) || !buildScenegraph(descriptor.absPath, descriptor.bakeAllSubmeshes)) {
 		return raco::core::SharedMeshData();
 	}
-	if (!descriptor.bakeAllSubmeshes && (descriptor.submeshIndex < 0 || descriptor.submeshIndex >= static_cast<int>(sceneToImport->mNumMeshes))) {
-		error_ = "Selected submesh index is out of valid submesh index range [0," + std::to_string(sceneToImport->mNumMeshes - 1) + "]";
+	if (!descriptor.bakeAllSubmeshes && (descriptor.submeshIndex < 0 || descriptor.submeshIndex >= static_cast<int>(scene_->mNumMeshes))) {
+		error_ = "Selected submesh index is out of valid submesh index range [0," + std::to_string(scene_->mNumMeshes - 1) + "]";
 		return raco::core::SharedMeshData();
 	}
-	return std::make_shared<glTFMesh>(*sceneToImport, descriptor);
+	return postProcessMesh(std::make_shared<glTFMesh>(*scene_, descriptor), descriptor);
+}
+
+size_t glTFFileLoader::memoryUsage() const {
+	if (!importer_) {
+		return 0;
+	}
+	aiMemoryInfo info;
+	importer_->GetMemoryRequirements(info);
+	return info.total;
 }
 
 std::string glTFFileLoader::getError() {
@@ -9,10 +9,37 @@
  */
 #include "mesh_loader/glTFMesh.h"
 
+#include "mesh_loader/VertexConversion.h"
+
 #include <assimp/scene.h>
+#include <algorithm>
 #include <stdexcept>
 #include <vector>
 
+namespace {
+
+struct MeshInstance {
+	const aiMesh *mesh;
+	aiMatrix4x4 transformation;
+	// Inverse transpose of the rotational part, used for normals and tangents.
+	aiMatrix3x3 normalTransformation;
+};
+
+// Same traversal and transformation as the aiProcess_PreTransformVertices post processing step.
+void collectMeshInstances(const aiScene &scene, const aiNode &node, const aiMatrix4x4 &parentTransformation, std::vector<MeshInstance> &instances) {
+	const aiMatrix4x4 transformation = parentTransformation * node.mTransformation;
+	aiMatrix3x3 normalTransformation(transformation);
+	normalTransformation.Inverse().Transpose();
+	for (unsigned i = 0; i < node.mNumMeshes; ++i) {
+		instances.emplace_back(MeshInstance{scene.mMeshes[node.mMeshes[i]], transformation, normalTransformation});
+	}
+	for (unsigned i = 0; i < node.mNumChildren; ++i) {
+		collectMeshInstances(scene, *node.mChildren[i], transformation, instances);
+	}
+}
+
+}  // namespace
+
 namespace raco::mesh_loader {
 
 using namespace raco::core;
@@ -20,143 +47,158 @@ using namespace raco::core;
 glTFMesh::glTFMesh(const aiScene &scene, const core::MeshDescriptor &descriptor) : numTriangles_(0), numVertices_(0) {
 	// Not included: Bones, textures, materials, node structure, etc.
 
+	// Collect all mesh instances of the scenegraph with their global transformation or the selected mesh.
+	std::vector<MeshInstance> instances;
+	if (descriptor.bakeAllSubmeshes) {
+		collectMeshInstances(scene, *scene.mRootNode, aiMatrix4x4(), instances);
+	} else {
+		instances.emplace_back(MeshInstance{scene.mMeshes[descriptor.submeshIndex], aiMatrix4x4(), aiMatrix3x3()});
+	}
+	std::vector<const aiMesh *> meshes;
+	for (const auto &instance : instances) {
+		meshes.emplace_back(instance.mesh);
+	}
+
+	// Determine the final buffer sizes up front, so that the loop below writes directly into the buffers we hand out.
+	// Optional attributes are only used if all collected meshes provide them.
+	size_t numIndices = 0;
+	bool hasTangents = !meshes.empty();
+	unsigned numUVChannels = meshes.empty() ? 0 : AI_MAX_NUMBER_OF_TEXTURECOORDS;
+	unsigned numColorChannels = meshes.empty() ? 0 : AI_MAX_NUMBER_OF_COLOR_SETS;
+	for (const auto *mesh : meshes) {
+		for (unsigned faceIndex = 0; faceIndex < mesh->mNumFaces; ++faceIndex) {
+			numIndices += mesh->mFaces[faceIndex].mNumIndices;
+		}
+		hasTangents = hasTangents && mesh->HasTangentsAndBitangents();
+		numUVChannels = std::min(numUVChannels, mesh->GetNumUVChannels());
+		numColorChannels = std::min(numColorChannels, mesh->GetNumColorChannels());
+		numVertices_ += mesh->mNumVertices;
+		numTriangles_ += mesh->mNumFaces;
+	}
+
+	std::vector<unsigned> uvComponents;
+	for (unsigned uvChannelIndex = 0; uvChannelIndex < numUVChannels; ++uvChannelIndex) {
+		const auto numComponents = meshes.front()->mNumUVComponents[uvChannelIndex] == 3 ? 3u : 2u;
+		if (std::any_of(meshes.begin(), meshes.end(), [uvChannelIndex, numComponents](const aiMesh *mesh) { return (mesh->mNumUVComponents[uvChannelIndex] == 3 ? 3u : 2u) != numComponents; })) {
+			break;
+		}
+		uvComponents.emplace_back(numComponents);
+	}
+
 	// set up buffers we are going to fill in the loop
-	std::vector<float> vertexBuffer{};
-	std::vector<float> normalBuffer{};
-	std::vector<float> tangentBuffer{};
-	std::vector<float> bitangentBuffer{};
+	std::vector<uint32_t> indexBuffer(numIndices);
+	std::vector<float> vertexBuffer(3 * numVertices_);
+	std::vector<float> normalBuffer(3 * numVertices_);
+	std::vector<float> tangentBuffer(hasTangents ? 3 * numVertices_ : 0);
+	std::vector<float> bitangentBuffer(hasTangents ? 3 * numVertices_ : 0);
 	std::vector<std::vector<float>> uvBuffers;
-	std::vector<int> uvBufferSizes;
-	std::vector<std::vector<float>> colorBuffers;
+	for (auto numComponents : uvComponents) {
+		uvBuffers.emplace_back(numComponents * numVertices_);
+	}
+	std::vector<std::vector<float>> colorBuffers(numColorChannels, std::vector<float>(4 * numVertices_));
 
-	// Collect all meshes or selected mesh.
-	unsigned meshIndexLimit = (descriptor.bakeAllSubmeshes) ? scene.mNumMeshes : descriptor.submeshIndex + 1;
-	for (unsigned meshIndex = (descriptor.bakeAllSubmeshes) ? 0 : descriptor.submeshIndex; meshIndex < meshIndexLimit; ++meshIndex) {
-		const aiMesh &mesh = *scene.mMeshes[meshIndex];
+	uint32_t vertexOffset = 0;
+	size_t indexOffset = 0;
+	for (const auto &instance : instances) {
+		const aiMesh &mesh = *instance.mesh;
+		const bool transformed = !instance.transformation.IsIdentity();
 
 		// TODO enable this again once we have meshnode submesh support:
 		//materials_.emplace_back(scene.mMaterials[mesh.mMaterialIndex]->GetName().C_Str());
 
 		// Collect our vertices.
-		for (unsigned vertexIndex = 0; vertexIndex < mesh.mNumVertices; ++vertexIndex) {
-			const aiVector3D &vertex{mesh.mVertices[vertexIndex]};
-			vertexBuffer.insert(vertexBuffer.end(), {vertex.x, vertex.y, vertex.z});
-
-			const auto &normal{mesh.mNormals[vertexIndex]};
-			normalBuffer.insert(normalBuffer.end(), {normal.x, normal.y, normal.z});
-
-			if (mesh.HasTangentsAndBitangents()) {
-				const auto &tangent{mesh.mTangents[vertexIndex]};
-				tangentBuffer.insert(tangentBuffer.end(), {tangent.x, tangent.y, tangent.z});
-				const auto &bitangent{mesh.mBitangents[vertexIndex]};
-				bitangentBuffer.insert(bitangentBuffer.end(), {bitangent.x, bitangent.y, bitangent.z});
+		const size_t offset = 3 * static_cast<size_t>(vertexOffset);
+		if (transformed) {
+			vertex_conversion::transformPoints(instance.transformation, mesh.mVertices, mesh.mNumVertices, vertexBuffer.data() + offset);
+			vertex_conversion::transformDirections(instance.normalTransformation, mesh.mNormals, mesh.mNumVertices, normalBuffer.data() + offset);
+			if (hasTangents) {
+				vertex_conversion::transformDirections(instance.normalTransformation, mesh.mTangents, mesh.mNumVertices, tangentBuffer.data() + offset);
+				vertex_conversion::transformDirections(instance.normalTransformation, mesh.mBitangents, mesh.mNumVertices, bitangentBuffer.data() + offset);
+			}
+		} else {
+			vertex_conversion::copyVec3(mesh.mVertices, mesh.mNumVertices, vertexBuffer.data() + offset);
+			vertex_conversion::copyVec3(mesh.mNormals, mesh.mNumVertices, normalBuffer.data() + offset);
+			if (hasTangents) {
+				vertex_conversion::copyVec3(mesh.mTangents, mesh.mNumVertices, tangentBuffer.data() + offset);
+				vertex_conversion::copyVec3(mesh.mBitangents, mesh.mNumVertices, bitangentBuffer.data() + offset);
 			}
 		}
 
 		// Collect our faces/indexes
 		// Note: we build the correct submesh ranges here in anticipation of submesh support in the meshnode.
-		IndexBufferRangeInfo bufferRange = {static_cast<uint32_t>(indexBuffer_.size()), 0};
-		for (unsigned faceIndex = 0; faceIndex < mesh.mNumFaces; ++faceIndex) {
-			const auto &face{mesh.mFaces[faceIndex]};
-
-			for (unsigned vertexIndex = 0; vertexIndex < face.mNumIndices; ++vertexIndex) {
-				indexBuffer_.push_back(face.mIndices[vertexIndex] + numVertices_);
-				++bufferRange.count;
-			}
-		}
+		IndexBufferRangeInfo bufferRange = {static_cast<uint32_t>(indexOffset), 0};
+		bufferRange.count = static_cast<uint32_t>(vertex_conversion::flattenFaceIndices(mesh.mFaces, mesh.mNumFaces, vertexOffset, indexBuffer.data() + indexOffset));
+		indexOffset += bufferRange.count;
 
 		// Add our mesh to the buffer ranges.
 		submeshIndexBufferRanges_.push_back(bufferRange);
 
 		// Collect all the UV maps.
-		for (unsigned uvChannelIndex = 0; uvChannelIndex < mesh.GetNumUVChannels(); ++uvChannelIndex) {
-			// Expand the buffers if we need more.
-			if (uvBuffers.size() <= uvChannelIndex) {
-				uvBuffers.emplace_back(std::vector<float>{});
-			}
-
-			std::vector<float> &uvBuffer{uvBuffers[uvChannelIndex]};
-
-			// Collect the UV coordinates.
-			const auto numComponents = mesh.mNumUVComponents[uvChannelIndex];
-			for (size_t vertexIndex = 0; vertexIndex < mesh.mNumVertices; ++vertexIndex) {
-				const aiVector3D &coordinate = mesh.mTextureCoords[uvChannelIndex][vertexIndex];
-				uvBuffer.insert(uvBuffer.end(), {coordinate.x, coordinate.y});
-				if (numComponents == 3) {
-					uvBuffer.push_back(coordinate.z);
-				}
+		for (unsigned uvChannelIndex = 0; uvChannelIndex < uvBuffers.size(); ++uvChannelIndex) {
+			const auto numComponents = uvComponents[uvChannelIndex];
+			float *uvBuffer = uvBuffers[uvChannelIndex].data() + numComponents * static_cast<size_t>(vertexOffset);
+			if (numComponents == 3) {
+				vertex_conversion::copyVec3(mesh.mTextureCoords[uvChannelIndex], mesh.mNumVertices, uvBuffer);
+			} else {
+				vertex_conversion::copyVec3ToVec2(mesh.mTextureCoords[uvChannelIndex], mesh.mNumVertices, uvBuffer);
 			}
-			uvBufferSizes.push_back(numComponents);
 		}  // end UV channel loop
 
 		// Collect colors
-		for (unsigned colorChannelIndex = 0; colorChannelIndex < mesh.GetNumColorChannels(); ++colorChannelIndex) {
-			if (colorBuffers.size() <= colorChannelIndex) {
-				colorBuffers.emplace_back(std::vector<float>{});
-			}
-			std::vector<float> &colorBuffer{colorBuffers[colorChannelIndex]};
-			for (size_t vertexIndex = 0; vertexIndex < mesh.mNumVertices; ++vertexIndex) {
-				const aiColor4D color = mesh.mColors[colorChannelIndex][vertexIndex];
-				colorBuffer.insert(colorBuffer.end(), {color.r, color.g, color.b, color.a});
-			}
+		for (unsigned colorChannelIndex = 0; colorChannelIndex < colorBuffers.size(); ++colorChannelIndex) {
+			float *colorBuffer = colorBuffers[colorChannelIndex].data() + 4 * static_cast<size_t>(vertexOffset);
+			vertex_conversion::copyColors(mesh.mColors[colorChannelIndex], mesh.mNumVertices, colorBuffer);
 		}
 
-		numVertices_ += mesh.mNumVertices;
-		numTriangles_ += mesh.mNumFaces;
+		vertexOffset += mesh.mNumVertices;
 	}  // end mesh loop
 
 	// TODO: only single material mesh right now; use full information from loop above when we have submesh support in meshnode
-	submeshIndexBufferRanges_ = {{0, static_cast<uint32_t>(indexBuffer_.size())}};
+	submeshIndexBufferRanges_ = {{0, static_cast<uint32_t>(indexBuffer.size())}};
 	materials_ = {"material"};
 
+	// The buffers are moved into their final place; none of them is copied.
+	indexBuffer_ = SharedBuffer<uint32_t>(std::move(indexBuffer));
+
 	// Add the vertices
 	attributes_.emplace_back(Attribute{
 		ATTRIBUTE_POSITION,
 		VertexAttribDataType::VAT_Float3,
-		vertexBuffer});
+		std::move(vertexBuffer)});
 
 	// Add the normals
 	attributes_.emplace_back(Attribute{
 		ATTRIBUTE_NORMAL,
 		VertexAttribDataType::VAT_Float3,
-		normalBuffer});
+		std::move(normalBuffer)});
 
-	if (tangentBuffer.size() > 0 && tangentBuffer.size() == bitangentBuffer.size() && tangentBuffer.size() == vertexBuffer.size()) {
-		attributes_.emplace_back(Attribute{ATTRIBUTE_TANGENT, VertexAttribDataType::VAT_Float3, tangentBuffer});
-		attributes_.emplace_back(Attribute{ATTRIBUTE_BITANGENT, VertexAttribDataType::VAT_Float3, bitangentBuffer});
+	if (hasTangents) {
+		attributes_.emplace_back(Attribute{ATTRIBUTE_TANGENT, VertexAttribDataType::VAT_Float3, std::move(tangentBuffer)});
+		attributes_.emplace_back(Attribute{ATTRIBUTE_BITANGENT, VertexAttribDataType::VAT_Float3, std::move(bitangentBuffer)});
 	}
 
 	// Add the UV maps
 	for (int bufferIndex = 0; bufferIndex < uvBuffers.size(); ++bufferIndex) {
-		const unsigned numComponents = uvBufferSizes[bufferIndex];
 		const std::string indexCharacter = (bufferIndex == 0) ? "" : std::to_string(bufferIndex);
-
-		// Check that uv buffer uses the same number of vertices as the vertex buffers;
-		if (vertexBuffer.size() / 3 == uvBuffers[bufferIndex].size() / numComponents) {
-			if (numComponents == 3) {
-				attributes_.emplace_back(Attribute{
-					std::string{ATTRIBUTE_UVWMAP} + indexCharacter,
-					VertexAttribDataType::VAT_Float3,
-					uvBuffers[bufferIndex]});
-			} else {
-				attributes_.emplace_back(Attribute{
-					std::string{ATTRIBUTE_UVMAP} + indexCharacter,
-					VertexAttribDataType::VAT_Float2,
-					uvBuffers[bufferIndex]});
-			}
+		if (uvComponents[bufferIndex] == 3) {
+			attributes_.emplace_back(Attribute{
+				std::string{ATTRIBUTE_UVWMAP} + indexCharacter,
+				VertexAttribDataType::VAT_Float3,
+				std::move(uvBuffers[bufferIndex])});
+		} else {
+			attributes_.emplace_back(Attribute{
+				std::string{ATTRIBUTE_UVMAP} + indexCharacter,
+				VertexAttribDataType::VAT_Float2,
+				std::move(uvBuffers[bufferIndex])});
 		}
 	}
 
 	for (unsigned colorChannelIndex = 0; colorChannelIndex < colorBuffers.size(); ++colorChannelIndex) {
 		const std::string indexCharacter = (colorChannelIndex == 0) ? "" : std::to_string(colorChannelIndex);
-
-		// Check that color buffer uses the same number of vertices as the vertex buffers;
-		if (vertexBuffer.size() / 3 == colorBuffers[colorChannelIndex].size() / 4) {
-			attributes_.emplace_back(Attribute{
-				std::string(ATTRIBUTE_COLOR) + indexCharacter,
-				VertexAttribDataType::VAT_Float4,
-				colorBuffers[colorChannelIndex]});
-		}
+		attributes_.emplace_back(Attribute{
+			std::string(ATTRIBUTE_COLOR) + indexCharacter,
+			VertexAttribDataType::VAT_Float4,
+			std::move(colorBuffers[colorChannelIndex])});
 	}
 }
 
@@ -176,7 +218,7 @@ std::vector<std::string> glTFMesh::getMaterialNames() const {
 	return materials_;
 }
 
-const std::vector<uint32_t> &glTFMesh::getIndices() const {
+SharedBuffer<uint32_t> glTFMesh::getIndices() const {
 	return indexBuffer_;
 }
 
@@ -9,12 +9,16 @@
  */
 #include <gtest/gtest.h>
 
+#include "mesh_loader/DiskCachedFileLoader.h"
+#include "mesh_loader/MeshDiskCache.h"
 #include "mesh_loader/glTFFileLoader.h"
 #include "testing/RacoBaseTest.h"
 #include "testing/TestEnvironmentCore.h"
 
 #include <assimp/Importer.hpp>
 
+#include <fstream>
+
 using namespace raco;
 
 class MeshLoaderTest : public TestEnvironmentCore {};
@@ -67,4 +71,147 @@ TEST_F(MeshLoaderTest, glTFLoadUnbakedThenBaked) {
 	ASSERT_EQ(unbakedMesh->numSubmeshes(), 1);
 	ASSERT_EQ(bakedMesh->numSubmeshes(), 1);  // TODO should be 4 with full submesh support
 	ASSERT_EQ(fileloader.getTotalMeshCount(desc.bakeAllSubmeshes), 4);
-}
\ No newline at end of file
+}
+
+TEST_F(MeshLoaderTest, glTFLoadUnbakedThenBakedParsesFileOnce) {
+	core::MeshDescriptor desc;
+	desc.absPath = cwd_path().append("meshes/CesiumMilkTruck/CesiumMilkTruck.gltf").string();
+	desc.bakeAllSubmeshes = false;
+
+	mesh_loader::glTFFileLoader fileloader(desc.absPath);
+	desc.submeshIndex = 0;
+	uint32_t unbakedVertices = fileloader.loadMesh(desc)->numVertices();
+	for (desc.submeshIndex = 1; desc.submeshIndex < fileloader.getTotalMeshCount(false); ++desc.submeshIndex) {
+		unbakedVertices += fileloader.loadMesh(desc)->numVertices();
+	}
+	auto memoryUsage = fileloader.memoryUsage();
+
+	desc.bakeAllSubmeshes = true;
+	auto bakedMesh = fileloader.loadMesh(desc);
+
+	ASSERT_EQ(fileloader.memoryUsage(), memoryUsage);
+	// The wheels of the truck are instanced twice.
+	ASSERT_GT(bakedMesh->numVertices(), unbakedVertices);
+	ASSERT_EQ(fileloader.getScenegraph(true).nodes.size(), 1);
+	ASSERT_EQ(fileloader.getScenegraph(false).meshes, fileloader.getScenegraph(true).meshes);
+}
+
+TEST_F(MeshLoaderTest, diskCacheReturnsIdenticalMesh) {
+	core::MeshDescriptor desc;
+	desc.absPath = cwd_path().append("meshes/CesiumMilkTruck/CesiumMilkTruck.gltf").string();
+	desc.bakeAllSubmeshes = false;
+	desc.submeshIndex = 1;
+
+	auto& diskCache = mesh_loader::MeshDiskCache::instance();
+	diskCache.setCacheDirectory((cwd_path() / "meshcache").string());
+
+	mesh_loader::DiskCachedFileLoader storingLoader(desc.absPath, std::make_unique<mesh_loader::glTFFileLoader>(desc.absPath));
+	auto importedMesh = storingLoader.loadMesh(desc);
+	auto hits = diskCache.hitCount();
+
+	mesh_loader::DiskCachedFileLoader cachedLoader(desc.absPath, std::make_unique<mesh_loader::glTFFileLoader>(desc.absPath));
+	auto cachedMesh = cachedLoader.loadMesh(desc);
+	diskCache.setCacheDirectory({});
+
+	ASSERT_EQ(diskCache.hitCount(), hits + 1);
+	ASSERT_EQ(cachedLoader.getTotalMeshCount(false), 4);
+	ASSERT_EQ(cachedLoader.getScenegraph(false).nodes.size(), storingLoader.getScenegraph(false).nodes.size());
+	ASSERT_EQ(cachedMesh->numVertices(), importedMesh->numVertices());
+	auto cachedIndices = cachedMesh->getIndices();
+	auto importedIndices = importedMesh->getIndices();
+	ASSERT_TRUE(std::equal(cachedIndices.begin(), cachedIndices.end(), importedIndices.begin(), importedIndices.end()));
+	ASSERT_EQ(cachedMesh->numAttributes(), importedMesh->numAttributes());
+	for (uint32_t i = 0; i < importedMesh->numAttributes(); i++) {
+		ASSERT_EQ(cachedMesh->attribName(i), importedMesh->attribName(i));
+		ASSERT_EQ(cachedMesh->attribDataSize(i), importedMesh->attribDataSize(i));
+		ASSERT_EQ(std::memcmp(cachedMesh->attribBuffer(i), importedMesh->attribBuffer(i), importedMesh->attribDataSize(i)), 0);
+		ASSERT_EQ(reinterpret_cast<uintptr_t>(cachedMesh->attribBuffer(i)) % 4, 0);
+	}
+
+	cachedMesh.reset();
+	std::error_code ec;
+	std::filesystem::remove_all(cwd_path() / "meshcache", ec);
+}
+
+TEST_F(MeshLoaderTest, diskCacheRemovesLeastRecentlyUsedRecords) {
+	auto cacheDirectory = cwd_path() / "meshcache_prune";
+	std::filesystem::remove_all(cacheDirectory);
+	auto& diskCache = mesh_loader::MeshDiskCache::instance();
+	diskCache.setCacheDirectory(cacheDirectory.string());
+
+	core::MeshDescriptor desc;
+	desc.absPath = cwd_path().append("meshes/CesiumMilkTruck/CesiumMilkTruck.gltf").string();
+	desc.bakeAllSubmeshes = false;
+	for (auto submesh : {0, 1}) {
+		desc.submeshIndex = submesh;
+		mesh_loader::DiskCachedFileLoader(desc.absPath, std::make_unique<mesh_loader::glTFFileLoader>(desc.absPath)).loadMesh(desc);
+	}
+
+	std::vector<std::filesystem::path> records;
+	for (const auto& entry : std::filesystem::directory_iterator(cacheDirectory)) {
+		records.emplace_back(entry.path());
+	}
+	ASSERT_EQ(records.size(), 2);
+	std::filesystem::last_write_time(records[0], std::filesystem::file_time_type::clock::now() - std::chrono::hours(1));
+
+	diskCache.setSizeLimit(std::filesystem::file_size(records[1]));
+	diskCache.setSizeLimit(mesh_loader::MeshDiskCache::defaultSizeLimit);
+	diskCache.setCacheDirectory({});
+
+	EXPECT_FALSE(std::filesystem::exists(records[0]));
+	EXPECT_TRUE(std::filesystem::exists(records[1]));
+	std::filesystem::remove_all(cacheDirectory);
+}
+
+TEST_F(MeshLoaderTest, diskCacheKeyDependsOnReferencedFilesOnly) {
+	auto folder = cwd_path() / "meshcache_key";
+	std::filesystem::remove_all(folder);
+	std::filesystem::create_directories(folder);
+	for (auto name : {"CesiumMilkTruck.gltf", "CesiumMilkTruck.png", "CesiumMilkTruck_data.bin"}) {
+		std::filesystem::copy_file(cwd_path() / "meshes/CesiumMilkTruck" / name, folder / name);
+	}
+	auto gltfPath = (folder / "CesiumMilkTruck.gltf").string();
+	auto key = mesh_loader::MeshDiskCache::fileKey(gltfPath);
+	ASSERT_TRUE(key.has_value());
+
+	std::ofstream(folder / "project.rca") << "{}";
+	EXPECT_EQ(mesh_loader::MeshDiskCache::fileKey(gltfPath), key);
+
+	std::ofstream(folder / "CesiumMilkTruck_data.bin", std::ios::binary | std::ios::app) << '\0';
+	EXPECT_NE(mesh_loader::MeshDiskCache::fileKey(gltfPath), key);
+
+	std::filesystem::remove_all(folder);
+}
+
+TEST_F(MeshLoaderTest, diskCacheRejectsRecordsWithInconsistentLayout) {
+	auto cacheDirectory = cwd_path() / "meshcache_layout";
+	std::filesystem::remove_all(cacheDirectory);
+	auto& diskCache = mesh_loader::MeshDiskCache::instance();
+	diskCache.setCacheDirectory(cacheDirectory.string());
+
+	core::MeshDescriptor desc;
+	desc.absPath = cwd_path().append("meshes/CesiumMilkTruck/CesiumMilkTruck.gltf").string();
+	desc.bakeAllSubmeshes = false;
+	desc.submeshIndex = 1;
+	mesh_loader::glTFFileLoader loader(desc.absPath);
+	auto mesh = loader.loadMesh(desc);
+	auto fileKey = mesh_loader::MeshDiskCache::fileKey(desc.absPath);
+	ASSERT_TRUE(fileKey.has_value());
+	diskCache.store(*fileKey, desc, *mesh, loader.getScenegraph(false), loader.getTotalMeshCount(false));
+	ASSERT_TRUE(diskCache.load(*fileKey, desc).has_value());
+
+	// Overwrite the vertex count, which follows magic, version, mesh count, submesh count and triangle count.
+	auto record = std::filesystem::directory_iterator(cacheDirectory)->path();
+	{
+		std::fstream file(record, std::ios::binary | std::ios::in | std::ios::out);
+		file.seekp(24);
+		uint32_t numVertices = 1;
+		file.write(reinterpret_cast<const char*>(&numVertices), sizeof(numVertices));
+	}
+	auto misses = diskCache.missCount();
+	EXPECT_FALSE(diskCache.load(*fileKey, desc).has_value());
+	EXPECT_EQ(diskCache.missCount(), misses + 1);
+
+	diskCache.setCacheDirectory({});
+	std::filesystem::remove_all(cacheDirectory);
+}
@@ -0,0 +1,164 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <gtest/gtest.h>
+
+#include "mesh_loader/MeshOptimizer.h"
+#include "mesh_loader/glTFFileLoader.h"
+#include "testing/TestEnvironmentCore.h"
+
+#include <QByteArray>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+using namespace raco;
+
+class MeshOptimizerTest : public TestEnvironmentCore {
+protected:
+	core::SharedMeshData load(const std::string& relativePath, bool optimize, int lodLevel = 0, bool quantize = false) {
+		core::MeshDescriptor desc;
+		desc.absPath = cwd_path().append(relativePath).string();
+		desc.optimizeMesh = optimize;
+		desc.lodLevel = lodLevel;
+		desc.quantizeAttributes = quantize;
+		mesh_loader::glTFFileLoader fileloader(desc.absPath);
+		return fileloader.loadMesh(desc);
+	}
+
+	static double acmr(const core::MeshData& mesh) {
+		auto indices = mesh.getIndices();
+		return mesh_loader::averageCacheMissRatio(indices.data(), indices.size());
+	}
+
+	// Positions of the triangle corners in sorted triangle order, to compare meshes independent of their index buffer layout.
+	static std::vector<std::array<float, 9>> sortedTriangles(const core::MeshData& mesh) {
+		auto positions = reinterpret_cast<const float*>(mesh.attribBuffer(mesh.attribIndex(core::MeshData::ATTRIBUTE_POSITION)));
+		auto indices = mesh.getIndices();
+		std::vector<std::array<float, 9>> triangles(indices.size() / 3);
+		for (size_t i = 0; i < indices.size(); i++) {
+			std::copy_n(positions + 3 * indices[i], 3, triangles[i / 3].begin() + 3 * (i % 3));
+		}
+		std::sort(triangles.begin(), triangles.end());
+		return triangles;
+	}
+
+	void checkOptimization(const std::string& relativePath) {
+		auto original = load(relativePath, false);
+		auto optimized = load(relativePath, true);
+		ASSERT_NE(original, nullptr);
+		ASSERT_NE(optimized, nullptr);
+
+		EXPECT_LE(acmr(*optimized), acmr(*original));
+		EXPECT_LE(optimized->numVertices(), original->numVertices());
+
+		ASSERT_EQ(optimized->numTriangles(), original->numTriangles());
+		ASSERT_EQ(optimized->numAttributes(), original->numAttributes());
+		ASSERT_EQ(optimized->submeshIndexBufferRanges().size(), original->submeshIndexBufferRanges().size());
+		for (uint32_t i = 0; i < original->numAttributes(); i++) {
+			ASSERT_EQ(optimized->attribName(i), original->attribName(i));
+			ASSERT_EQ(optimized->attribDataType(i), original->attribDataType(i));
+			ASSERT_EQ(optimized->attribElementCount(i), optimized->numVertices());
+		}
+		ASSERT_EQ(sortedTriangles(*optimized), sortedTriangles(*original));
+
+		// Vertices are numbered in order of first use.
+		auto indices = optimized->getIndices();
+		uint32_t nextNewVertex = 0;
+		for (auto index : indices) {
+			ASSERT_LE(index, nextNewVertex);
+			nextNewVertex = std::max(nextNewVertex, index + 1);
+		}
+		ASSERT_EQ(nextNewVertex, optimized->numVertices());
+	}
+};
+
+TEST_F(MeshOptimizerTest, acmr_of_triangle_strip_order) {
+	// Triangles of a strip share two vertices with their predecessor: one miss per triangle after the first one.
+	std::vector<uint32_t> strip;
+	for (uint32_t i = 0; i < 100; i++) {
+		strip.insert(strip.end(), {i, i + 1, i + 2});
+	}
+	ASSERT_DOUBLE_EQ(mesh_loader::averageCacheMissRatio(strip.data(), strip.size()), 102.0 / 100.0);
+
+	std::vector<uint32_t> unshared;
+	for (uint32_t i = 0; i < 300; i++) {
+		unshared.emplace_back(i);
+	}
+	ASSERT_DOUBLE_EQ(mesh_loader::averageCacheMissRatio(unshared.data(), unshared.size()), 3.0);
+}
+
+TEST_F(MeshOptimizerTest, optimize_duck) {
+	checkOptimization("meshes/Duck.glb");
+}
+
+TEST_F(MeshOptimizerTest, optimize_truck) {
+	checkOptimization("meshes/CesiumMilkTruck/CesiumMilkTruck.gltf");
+}
+
+TEST_F(MeshOptimizerTest, lod_levels_of_duck) {
+	auto previous = load("meshes/Duck.glb", false);
+	for (int lodLevel = 1; lodLevel <= 3; lodLevel++) {
+		auto simplified = load("meshes/Duck.glb", false, lodLevel);
+		ASSERT_NE(simplified, nullptr);
+		ASSERT_LT(simplified->numTriangles(), previous->numTriangles());
+		ASSERT_LT(simplified->numVertices(), previous->numVertices());
+		ASSERT_EQ(simplified->numAttributes(), previous->numAttributes());
+		ASSERT_EQ(simplified->submeshIndexBufferRanges().back().count, simplified->getIndices().size());
+		ASSERT_EQ(simplified->numFullDetailTriangles(), 4212);
+		previous = simplified;
+	}
+	// The duck is a closed surface, so it can be simplified down to the target.
+	ASSERT_LE(previous->numTriangles(), 4212 / 8 + 2);
+}
+
+TEST_F(MeshOptimizerTest, lod_level_and_optimization_combined) {
+	auto simplified = load("meshes/Duck.glb", false, 1);
+	auto optimized = load("meshes/Duck.glb", true, 1);
+	ASSERT_EQ(optimized->numTriangles(), simplified->numTriangles());
+	ASSERT_EQ(optimized->numFullDetailTriangles(), simplified->numFullDetailTriangles());
+	ASSERT_EQ(sortedTriangles(*optimized), sortedTriangles(*simplified));
+	EXPECT_LE(acmr(*optimized), acmr(*simplified));
+}
+
+TEST_F(MeshOptimizerTest, quantize_truck_attributes) {
+	auto original = load("meshes/CesiumMilkTruck/CesiumMilkTruck.gltf", false);
+	auto quantized = load("meshes/CesiumMilkTruck/CesiumMilkTruck.gltf", false, 0, true);
+	ASSERT_EQ(quantized->numVertices(), original->numVertices());
+	ASSERT_EQ(quantized->numAttributes(), original->numAttributes());
+
+	size_t originalCompressed = 0;
+	size_t quantizedCompressed = 0;
+	for (uint32_t i = 0; i < original->numAttributes(); i++) {
+		auto name = original->attribName(i);
+		ASSERT_EQ(quantized->attribName(i), name);
+		ASSERT_EQ(quantized->attribDataType(i), original->attribDataType(i));
+		ASSERT_EQ(quantized->attribDataSize(i), original->attribDataSize(i));
+		originalCompressed += qCompress(QByteArray::fromRawData(original->attribBuffer(i), original->attribDataSize(i))).size();
+		quantizedCompressed += qCompress(QByteArray::fromRawData(quantized->attribBuffer(i), quantized->attribDataSize(i))).size();
+
+		auto before = reinterpret_cast<const float*>(original->attribBuffer(i));
+		auto after = reinterpret_cast<const float*>(quantized->attribBuffer(i));
+		size_t count = original->attribDataSize(i) / sizeof(float);
+		if (name == core::MeshData::ATTRIBUTE_POSITION) {
+			ASSERT_TRUE(std::equal(before, before + count, after));
+		} else if (name == core::MeshData::ATTRIBUTE_NORMAL) {
+			for (size_t offset = 0; offset < count; offset += 3) {
+				float cosine = before[offset] * after[offset] + before[offset + 1] * after[offset + 1] + before[offset + 2] * after[offset + 2];
+				ASSERT_GT(cosine, 0.9999f) << "normal " << offset / 3;
+			}
+		} else if (name.rfind(core::MeshData::ATTRIBUTE_UVMAP, 0) == 0) {
+			for (size_t offset = 0; offset < count; offset++) {
+				ASSERT_NEAR(after[offset], before[offset], std::abs(before[offset]) / 2048.0f + 1e-7f);
+			}
+		}
+	}
+	EXPECT_LT(quantizedCompressed, originalCompressed);
+}
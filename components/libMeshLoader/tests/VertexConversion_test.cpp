@@ -0,0 +1,119 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <gtest/gtest.h>
+
+#include "mesh_loader/VertexConversion.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace raco::mesh_loader::vertex_conversion;
+
+class VertexConversionTest : public ::testing::Test {
+protected:
+	// Odd count, so that the remainder loops of the vectorized kernels are exercised.
+	static constexpr size_t numVertices = 1003;
+
+	void SetUp() override {
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+		vectors.resize(numVertices);
+		for (auto& vector : vectors) {
+			vector = aiVector3D(distribution(generator), distribution(generator), distribution(generator));
+		}
+		vectors[7] = aiVector3D(0.0f, 0.0f, 0.0f);
+
+		indices.resize(3 * numVertices);
+		for (size_t i = 0; i < indices.size(); i++) {
+			indices[i] = static_cast<unsigned int>(i % numVertices);
+		}
+		faces.resize(numVertices);
+		for (size_t i = 0; i < numVertices; i++) {
+			faces[i].mNumIndices = 3;
+			faces[i].mIndices = indices.data() + 3 * i;
+		}
+
+		transformation = aiMatrix4x4(aiVector3D(2.0f, 1.0f, 0.5f), aiQuaternion(0.3f, 1.2f, -0.7f), aiVector3D(4.0f, -3.0f, 1.5f));
+		normalTransformation = aiMatrix3x3(transformation);
+		normalTransformation.Inverse().Transpose();
+	}
+
+	void TearDown() override {
+		// The faces don't own their index arrays.
+		for (auto& face : faces) {
+			face.mIndices = nullptr;
+			face.mNumIndices = 0;
+		}
+		setSimdLevel(supportedSimdLevel());
+	}
+
+	template <typename Kernel>
+	std::vector<float> runAt(SimdLevel level, size_t size, Kernel kernel) {
+		setSimdLevel(level);
+		std::vector<float> result(size);
+		kernel(result.data());
+		return result;
+	}
+
+	template <typename Kernel>
+	void expectSameResultOnAllLevels(size_t size, Kernel kernel) {
+		auto expected = runAt(SimdLevel::Scalar, size, kernel);
+		for (auto level : {SimdLevel::SSE2, SimdLevel::AVX2}) {
+			if (level <= supportedSimdLevel()) {
+				auto result = runAt(level, size, kernel);
+				for (size_t i = 0; i < size; i++) {
+					ASSERT_NEAR(result[i], expected[i], 1e-4f * std::max(1.0f, std::abs(expected[i]))) << "level " << static_cast<int>(level) << " index " << i;
+				}
+			}
+		}
+	}
+
+	std::vector<aiVector3D> vectors;
+	std::vector<unsigned int> indices;
+	std::vector<aiFace> faces;
+	aiMatrix4x4 transformation;
+	aiMatrix3x3 normalTransformation;
+};
+
+TEST_F(VertexConversionTest, copyVec3ToVec2_same_on_all_levels) {
+	expectSameResultOnAllLevels(2 * numVertices, [this](float* destination) {
+		copyVec3ToVec2(vectors.data(), numVertices, destination);
+	});
+	auto result = runAt(supportedSimdLevel(), 2 * numVertices, [this](float* destination) {
+		copyVec3ToVec2(vectors.data(), numVertices, destination);
+	});
+	ASSERT_EQ(result[2 * 5 + 1], vectors[5].y);
+}
+
+TEST_F(VertexConversionTest, transformPoints_same_on_all_levels) {
+	expectSameResultOnAllLevels(3 * numVertices, [this](float* destination) {
+		transformPoints(transformation, vectors.data(), numVertices, destination);
+	});
+}
+
+TEST_F(VertexConversionTest, transformDirections_same_on_all_levels) {
+	expectSameResultOnAllLevels(3 * numVertices, [this](float* destination) {
+		transformDirections(normalTransformation, vectors.data(), numVertices, destination);
+	});
+	auto result = runAt(supportedSimdLevel(), 3 * numVertices, [this](float* destination) {
+		transformDirections(normalTransformation, vectors.data(), numVertices, destination);
+	});
+	ASSERT_EQ(result[3 * 7], 0.0f);
+	ASSERT_NEAR(aiVector3D(result[0], result[1], result[2]).Length(), 1.0f, 1e-5f);
+}
+
+TEST_F(VertexConversionTest, flattenFaceIndices_adds_offset) {
+	std::vector<uint32_t> result(3 * numVertices);
+	ASSERT_EQ(flattenFaceIndices(faces.data(), faces.size(), 100, result.data()), result.size());
+	ASSERT_EQ(result[4], indices[4] + 100);
+	ASSERT_EQ(result.back(), indices.back() + 100);
+}
@@ -19,11 +19,12 @@
 
 namespace raco::ramses_adaptor {
 
-class CubeMapAdaptor : public TypedObjectAdaptor<user_types::CubeMap, ramses::TextureSampler> {
+class CubeMapAdaptor : public TypedObjectAdaptor<user_types::CubeMap, ramses::TextureSampler>, public IImageProvider {
 public:
 	explicit CubeMapAdaptor(SceneAdaptor* sceneAdaptor, std::shared_ptr<user_types::CubeMap> editorObject);
 
 	bool sync(core::Errors* errors) override;
+	void getPendingImages(std::vector<ramses_base::ImageRequest>& images) override;
 
 private:
 	raco::ramses_base::RamsesTextureCube createTexture(core::Errors* errors);
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "core/Link.h"
+#include "ramses_adaptor/LogicOutputSnapshot.h"
 #include <ramses-logic/LogicEngine.h>
 #include <ramses-logic/Property.h>
 #include "components/DataChangeDispatcher.h"
@@ -37,12 +38,15 @@ public:
 	void lift();
 	void connect();
 
-	void readDataFromEngine(core::DataChangeRecorder &recorder);
+	void readDataFromEngine(core::DataChangeRecorder& recorder, LogicReadbackStatistics& statistics);
+	// Discard the cached destination values; called when the link end object has been changed.
+	void resetOutputSnapshot();
 
 protected:
 	SceneAdaptor* sceneAdaptor_;
 	core::LinkDescriptor editorLink_;
 	std::vector<UniqueEngineLink> engineLink_;
+	LogicOutputSnapshot outputSnapshot_;
 };
 using UniqueLinkAdaptor = std::unique_ptr<LinkAdaptor>;
 
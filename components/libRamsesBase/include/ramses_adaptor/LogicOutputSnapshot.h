@@ -0,0 +1,67 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include "core/ChangeRecorder.h"
+#include "core/Handles.h"
+#include <ramses-logic/Property.h>
+
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace raco::ramses_adaptor {
+
+// Both counters count leaf engine properties: scalars, strings and vectors. A vector counts as a single property,
+// it is counted as written if any of its components changed in the data model.
+struct LogicReadbackStatistics {
+	// Number of leaf engine properties compared against the snapshot.
+	size_t propertiesRead{0};
+	// Number of leaf engine properties whose value was written to the data model and recorded in the DataChangeRecorder.
+	size_t propertiesWritten{0};
+};
+
+/**
+ * Flattened snapshot of the leaf properties of a logic engine property tree together with the
+ * data model properties they are read back into and the engine values seen by the last readback.
+ *
+ * Only leaves whose engine value differs from the snapshot are written to the data model.
+ * The snapshot must be reset whenever the engine property tree or the data model structure may have
+ * changed; the next readback then rebuilds it and compares all leaves against the data model.
+ */
+class LogicOutputSnapshot {
+public:
+	bool empty() const {
+		return !valid_;
+	}
+
+	void reset();
+
+	// Build the snapshot for the given property tree; both trees must have the same structure.
+	void build(const rlogic::Property& property, const core::ValueHandle& valueHandle);
+
+	void readDataFromEngine(core::DataChangeRecorder& recorder, LogicReadbackStatistics& statistics);
+
+private:
+	using EngineValue = std::variant<std::monostate, float, int32_t, bool, rlogic::vec2f, rlogic::vec3f, rlogic::vec4f, rlogic::vec2i, rlogic::vec3i, rlogic::vec4i, std::string>;
+
+	struct Leaf {
+		const rlogic::Property* property;
+		core::ValueHandle valueHandle;
+		EngineValue value;
+	};
+
+	void addLeaves(const rlogic::Property& property, const core::ValueHandle& valueHandle);
+
+	std::vector<Leaf> leaves_;
+	bool valid_{false};
+};
+
+}  // namespace raco::ramses_adaptor
@@ -21,7 +21,7 @@
 
 namespace raco::ramses_adaptor {
 
-class LuaScriptAdaptor : public ObjectAdaptor, public ILogicPropertyProvider {
+class LuaScriptAdaptor : public ObjectAdaptor, public ILogicPropertyProvider, public ILogicOutputProvider {
 public:
 	explicit LuaScriptAdaptor(SceneAdaptor* sceneAdaptor, std::shared_ptr<user_types::LuaScript> editorObject);
 	SEditorObject baseEditorObject() noexcept override;
@@ -31,7 +31,8 @@ public:
 	void onRuntimeError(core::Errors& errors, std::string const& message, core::ErrorLevel level) override;
 
 	bool sync(core::Errors* errors) override;
-	void readDataFromEngine(core::DataChangeRecorder &recorder); 
+	void readDataFromEngine(core::DataChangeRecorder& recorder, LogicReadbackStatistics& statistics) override;
+	void resetOutputSnapshot() override;
 
 	rlogic::LuaScript* rlogicLuaScript() const {
 		return luaScript_.get();
@@ -53,6 +54,7 @@ private:
 	// or if it is sufficient to just update the input properties.
 	bool recreateStatus_ = true;
 	SEditorObject parent_;
+	LogicOutputSnapshot outputSnapshot_;
 };
 
 };	// namespace raco::ramses_adaptor
@@ -13,6 +13,7 @@
 #include "ramses_adaptor/ObjectAdaptor.h"
 #include "user_types/Material.h"
 #include <array>
+#include <optional>
 
 namespace raco::ramses_adaptor {
 
@@ -32,17 +33,33 @@ public:
 		return appearance_;
 	}
 
+	// Number of ramses::Effect objects created by this adaptor for the material shaders.
+	size_t effectCreationCount() const {
+		return effectCreationCount_;
+	}
+
 	void getLogicNodes(std::vector<rlogic::LogicNode*>& logicNodes) const override;
 	const rlogic::Property* getProperty(const std::vector<std::string>& propertyNamesVector) override;
 	void onRuntimeError(core::Errors& errors, std::string const& message, core::ErrorLevel level) override;
 
 private:
+	bool syncEffect();
+
 	raco::ramses_base::RamsesAppearance appearance_;
 	raco::ramses_base::UniqueRamsesAppearanceBinding appearanceBinding_;
 
 	components::Subscription subscription_;
+	components::Subscription nameSubscription_;
 	components::Subscription optionsSubscription_;
 	components::Subscription uniformSubscription_;
+
+	// Set if the shader sources may have changed and need to be checked against effectKey_.
+	bool effectStatus_ = true;
+	// Set if the appearance and appearance binding need to be recreated, e.g. after a name change.
+	bool recreateStatus_ = true;
+	// Hash of the shader sources used for the current effect; empty if the default empty effect is used.
+	std::optional<std::string> effectKey_;
+	size_t effectCreationCount_ = 0;
 };
 
 void updateAppearance(SceneAdaptor* sceneAdaptor, raco::ramses_base::RamsesAppearance appearance, const core::ValueHandle& optionsContHandle, const core::ValueHandle& uniformConHandle);
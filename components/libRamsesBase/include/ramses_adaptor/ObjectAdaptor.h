@@ -11,9 +11,11 @@
 
 #include "core/Errors.h"
 #include "data_storage/Value.h"
+#include "ramses_adaptor/LogicOutputSnapshot.h"
 #include "ramses_adaptor/utilities.h"
 #include "ramses_adaptor/SceneAdaptor.h"
 #include "ramses_base/RamsesHandles.h"
+#include "ramses_base/TextureDataCache.h"
 #include <ramses-client-api/RamsesObject.h>
 #include <ramses-framework-api/RamsesVersion.h>
 #include <ramses-logic/Property.h>
@@ -29,6 +31,19 @@ public:
 	virtual void onRuntimeError(core::Errors& errors, std::string const& message, core::ErrorLevel level) = 0;
 };
 
+class ILogicOutputProvider {
+public:
+	// Write the engine values which changed since the last readback into the data model.
+	virtual void readDataFromEngine(core::DataChangeRecorder& recorder, LogicReadbackStatistics& statistics) = 0;
+	// Discard the cached engine values; called when the data model of the adaptor has been changed.
+	virtual void resetOutputSnapshot() = 0;
+};
+
+class IImageProvider {
+public:
+	// Add the images the next sync will decode; they are decoded in parallel before the adaptors are synced.
+	virtual void getPendingImages(std::vector<ramses_base::ImageRequest>& images) = 0;
+};
 
 class ISceneObjectProvider {
 public:
@@ -13,13 +13,19 @@
 #include "ramses_adaptor/LinkAdaptor.h"
 #include "ramses_base/LogicEngine.h"
 #include "ramses_base/RamsesHandles.h"
+#include "ramses_base/TextureDataCache.h"
 #include "components/DataChangeDispatcher.h"
 #include <map>
+#include <set>
+#include <vector>
 #include "core/Link.h"
 
 namespace raco::ramses_adaptor {
 
 class ObjectAdaptor;
+class ILogicPropertyProvider;
+class ILogicOutputProvider;
+class IImageProvider;
 
 using SRamsesAdaptorDispatcher = std::shared_ptr<components::DataChangeDispatcher>;
 class SceneAdaptor {
@@ -49,6 +55,12 @@ public:
 	ObjectAdaptor* lookupAdaptor(const core::SEditorObject& editorObject) const;
 	Project& project() const;
 
+	// Register a dirty adaptor to be synced by the next bulk engine update; called by ObjectAdaptor::tagDirty.
+	void markAdaptorDirty(const core::SEditorObject& editorObject);
+
+	// Return the image decoded in advance by the current bulk engine update or decode it through the TextureDataCache.
+	ramses_base::SharedDecodedImage decodeImage(const std::string& absPath, bool flipVertically);
+
 	template <class T>
 	T* lookup(const core::SEditorObject& editorObject) const {
 		return dynamic_cast<T*>(lookupAdaptor(editorObject));
@@ -57,12 +69,20 @@ public:
 
 	void readDataFromEngine(core::DataChangeRecorder &recorder);
 
+	// Number of properties read from the logic engine and written into the data model by the last readDataFromEngine call.
+	const LogicReadbackStatistics& readbackStatistics() const;
+
+	// Number of objects visited by the last bulk engine update, whether or not their adaptors needed a sync.
+	size_t bulkUpdateVisitedObjects() const;
+
 	void iterateAdaptors(std::function<void(ObjectAdaptor*)> func);
 
 private:
 	void createLink(const core::LinkDescriptor& link);
 	void changeLinkValidity(const core::LinkDescriptor& link, bool isValid);
 	void removeLink(const core::LinkDescriptor& link);
+	void addLinkToIndex(const core::LinkDescriptor& link, LinkAdaptor* adaptor);
+	void removeLinkFromIndex(const core::LinkDescriptor& link, LinkAdaptor* adaptor);
 	void createAdaptor(SEditorObject obj);
 	void removeAdaptor(SEditorObject obj);
 
@@ -70,16 +90,22 @@ private:
 	void buildRenderableOrder(ramses::RenderGroup& renderGroup, std::vector<SEditorObject>& objs, const std::function<void(const SEditorObject&)>& renderableOrderFunc);
 
 	void performBulkEngineUpdate(const std::set<SEditorObject>& changedObjects);
+	void decodePendingImages();
 
 	struct DependencyNode {
 		SEditorObject object;
+		// Position in the topological order: referenced objects always have a smaller order than the objects referencing them.
+		size_t order;
 		std::set<SEditorObject> referencedObjects;
+		std::set<SEditorObject> referencingObjects;
 	};
 
-	void depthFirstSearch(data_storage::ReflectionInterface* object, DependencyNode& item, std::set<SEditorObject> const& instances, std::set<SEditorObject>& sortedObjs, std::vector<DependencyNode>& outSorted);
-
-	void depthFirstSearch(SEditorObject object, std::set<SEditorObject> const& instances, std::set<SEditorObject>& sortedObjs, std::vector<DependencyNode>& outSorted);
-	void rebuildSortedDependencyGraph(std::set<SEditorObject> const& objects);
+	void addDependencyNode(SEditorObject object);
+	void removeDependencyNode(SEditorObject object);
+	void updateDependencyNode(DependencyNode& node);
+	void addDependencyEdge(DependencyNode& node, DependencyNode& referenced);
+	void collectReferencedObjects(const data_storage::ReflectionInterface& object, std::set<SEditorObject>& outReferenced) const;
+	bool collectReorderRegion(DependencyNode& start, size_t bound, bool forward, const SEditorObject& cycleTarget, std::vector<DependencyNode*>& outNodes);
 
 	void updateRuntimeErrorList();
 
@@ -108,12 +134,31 @@ private:
 
 	std::map<SEditorObject, std::unique_ptr<ObjectAdaptor>> adaptors_{};
 	std::map<core::LinkDescriptor, UniqueLinkAdaptor> links_{};
+	// LinkAdaptors indexed by their start and end objects for fast lookup of the links affected by an object update.
+	std::map<SEditorObject, std::set<LinkAdaptor*>> linksByObject_{};
 	components::Subscription subscription_;
 	components::Subscription linksLifecycle_;
 	components::Subscription linkValidityChangeSub_;
 	SRamsesAdaptorDispatcher dispatcher_;
 
-	std::vector<DependencyNode> dependencyGraph_;
+	// Reference graph of all project instances, kept up to date incrementally from the changed objects of each bulk update.
+	std::map<SEditorObject, DependencyNode> dependencyGraph_;
+	size_t nextDependencyOrder_{0};
+	std::set<SEditorObject> dirtyObjects_;
+	size_t bulkUpdateVisitedObjects_{0};
+
+	components::Subscription childrenSubscription_;
+	bool renderGroupDirty_{true};
+
+	// Adaptors participating in the logic engine, registered on adaptor creation.
+	std::map<SEditorObject, ILogicPropertyProvider*> logicPropertyProviders_;
+	std::map<SEditorObject, ILogicOutputProvider*> logicOutputProviders_;
+	LogicReadbackStatistics readbackStatistics_;
+
+	// Adaptors decoding images in their sync.
+	std::map<SEditorObject, IImageProvider*> imageProviders_;
+	// Images decoded in parallel by decodePendingImages, held until the adaptors have been synced.
+	std::map<std::pair<std::string, bool>, ramses_base::SharedDecodedImage> pendingImages_;
 };
 
 }  // namespace raco::ramses_adaptor
@@ -19,11 +19,16 @@
 
 namespace raco::ramses_adaptor {
 
-class TextureSamplerAdaptor : public TypedObjectAdaptor<user_types::Texture, ramses::TextureSampler> {
+class TextureSamplerAdaptor : public TypedObjectAdaptor<user_types::Texture, ramses::TextureSampler>, public IImageProvider {
 public:
 	explicit TextureSamplerAdaptor(SceneAdaptor* sceneAdaptor, std::shared_ptr<user_types::Texture> editorObject);
 
 	bool sync(core::Errors* errors) override;
+	void getPendingImages(std::vector<ramses_base::ImageRequest>& images) override;
+
+	ramses_base::RamsesTexture2D textureData() const {
+		return textureData_;
+	}
 
 	static std::vector<unsigned char>* getFallbackTextureData(int mode);
 
@@ -33,6 +38,8 @@ private:
 
 	std::array<components::Subscription, 6> subscriptions_;
 	ramses_base::RamsesTexture2D textureData_;
+	// Set if the image content may have changed; otherwise only the sampler is recreated by sync.
+	bool textureStatus_ = true;
 
 	static inline std::vector<unsigned char> fallbackTextureData_[2];
 	std::string createDefaultTextureDataName();
@@ -238,115 +238,148 @@ inline bool setLuaInputInEngine(rlogic::Property* property, const core::ValueHan
 
 class ReadFromEngineManager {
 public:
+	// The setters return the number of properties written to the data model and recorded as changed.
 	template <typename Type>
-	static void setValueFromEngineValue(const core::ValueHandle& valueHandle, Type newValue, core::DataChangeRecorder& recorder) {
+	static size_t setValueFromEngineValue(const core::ValueHandle& valueHandle, Type newValue, core::DataChangeRecorder& recorder) {
 		auto oldValue = valueHandle.as<Type>();
 		if (oldValue != newValue) {
 			valueHandle.valueRef()->set(static_cast<Type>(newValue));
 			recorder.recordValueChanged(valueHandle);
+			return 1;
 		}
+		return 0;
 	}
 
-	static void setVec2f(const core::ValueHandle& handle, double x, double y, core::DataChangeRecorder& recorder) {
+	static size_t setVec2f(const core::ValueHandle& handle, double x, double y, core::DataChangeRecorder& recorder) {
 		raco::data_storage::Vec2f& v = handle.valueRef()->asVec2f();
+		size_t written = 0;
 
 		if (*v.x != x) {
 			v.x = x;
 			recorder.recordValueChanged(handle[0]);
+			written++;
 		}
 		if (*v.y != y) {
 			v.y = y;
 			recorder.recordValueChanged(handle[1]);
+			written++;
 		}
+		return written;
 	}
 
-	static void setVec3f(const core::ValueHandle& handle, double x, double y, double z, core::DataChangeRecorder& recorder) {
+	static size_t setVec3f(const core::ValueHandle& handle, double x, double y, double z, core::DataChangeRecorder& recorder) {
 		raco::data_storage::Vec3f& v = handle.valueRef()->asVec3f();
+		size_t written = 0;
 
 		if (*v.x != x) {
 			v.x = x;
 			recorder.recordValueChanged(handle[0]);
+			written++;
 		}
 		if (*v.y != y) {
 			v.y = y;
 			recorder.recordValueChanged(handle[1]);
+			written++;
 		}
 		if (*v.z != z) {
 			v.z = z;
 			recorder.recordValueChanged(handle[2]);
+			written++;
 		}
+		return written;
 	}
 
-	static void setVec4f(const core::ValueHandle& handle, double x, double y, double z, double w, core::DataChangeRecorder& recorder) {
+	static size_t setVec4f(const core::ValueHandle& handle, double x, double y, double z, double w, core::DataChangeRecorder& recorder) {
 		raco::data_storage::Vec4f& v = handle.valueRef()->asVec4f();
+		size_t written = 0;
 
 		if (*v.x != x) {
 			v.x = x;
 			recorder.recordValueChanged(handle[0]);
+			written++;
 		}
 		if (*v.y != y) {
 			v.y = y;
 			recorder.recordValueChanged(handle[1]);
+			written++;
 		}
 		if (*v.z != z) {
 			v.z = z;
 			recorder.recordValueChanged(handle[2]);
+			written++;
 		}
 		if (*v.w != w) {
 			v.w = w;
 			recorder.recordValueChanged(handle[3]);
+			written++;
 		}
+		return written;
 	}
 
-	static void setVec2i(const core::ValueHandle& handle, int x, int y, core::DataChangeRecorder& recorder) {
+	static size_t setVec2i(const core::ValueHandle& handle, int x, int y, core::DataChangeRecorder& recorder) {
 		raco::data_storage::Vec2i& v = handle.valueRef()->asVec2i();
+		size_t written = 0;
 
 		if (*v.i1_ != x) {
 			v.i1_ = x;
 			recorder.recordValueChanged(handle[0]);
+			written++;
 		}
 		if (*v.i2_ != y) {
 			v.i2_ = y;
 			recorder.recordValueChanged(handle[1]);
+			written++;
 		}
+		return written;
 	}
 
-	static void setVec3i(const core::ValueHandle& handle, int x, int y, int z, core::DataChangeRecorder& recorder) {
+	static size_t setVec3i(const core::ValueHandle& handle, int x, int y, int z, core::DataChangeRecorder& recorder) {
 		raco::data_storage::Vec3i& v = handle.valueRef()->asVec3i();
+		size_t written = 0;
 
 		if (*v.i1_ != x) {
 			v.i1_ = x;
 			recorder.recordValueChanged(handle[0]);
+			written++;
 		}
 		if (*v.i2_ != y) {
 			v.i2_ = y;
 			recorder.recordValueChanged(handle[1]);
+			written++;
 		}
 		if (*v.i3_ != z) {
 			v.i3_ = z;
 			recorder.recordValueChanged(handle[2]);
+			written++;
 		}
+		return written;
 	}
 
-	static void setVec4i(const core::ValueHandle& handle, int x, int y, int z, int w, core::DataChangeRecorder& recorder) {
+	static size_t setVec4i(const core::ValueHandle& handle, int x, int y, int z, int w, core::DataChangeRecorder& recorder) {
 		raco::data_storage::Vec4i& v = handle.valueRef()->asVec4i();
+		size_t written = 0;
 
 		if (*v.i1_ != x) {
 			v.i1_ = x;
 			recorder.recordValueChanged(handle[0]);
+			written++;
 		}
 		if (*v.i2_ != y) {
 			v.i2_ = y;
 			recorder.recordValueChanged(handle[1]);
+			written++;
 		}
 		if (*v.i3_ != z) {
 			v.i3_ = z;
 			recorder.recordValueChanged(handle[2]);
+			written++;
 		}
 		if (*v.i4_ != w) {
 			v.i4_ = w;
 			recorder.recordValueChanged(handle[3]);
+			written++;
 		}
+		return written;
 	}
 };
 
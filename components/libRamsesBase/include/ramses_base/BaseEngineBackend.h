@@ -15,6 +15,7 @@
 #include <ramses-framework-api/RamsesFrameworkConfig.h>
 #include "ramses_base/CoreInterfaceImpl.h"
 #include "ramses_base/LogicEngine.h"
+#include "ramses_base/ShaderInterfaceCache.h"
 #include <QtCore>
 #include <memory>
 
@@ -37,6 +38,7 @@ public:
 	ramses::RamsesClient& client();
 	LogicEngine& logicEngine();
 	raco::core::EngineInterface* coreInterface();
+	ShaderInterfaceCache& shaderInterfaceCache();
 
 	/**
 	 * Scene used for internal validation / creation of resource.
@@ -49,6 +51,7 @@ private:
 	LogicEngine logicEngine_;
 	UniqueClient client_;
 	UniqueScene scene_;
+	ShaderInterfaceCache shaderInterfaceCache_;
 	CoreInterfaceImpl coreInterface_;
 };
 
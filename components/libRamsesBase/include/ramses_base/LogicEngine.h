@@ -9,12 +9,23 @@
  */
 #pragma once
 
+#include "ramses_base/LuaScriptCache.h"
+
 #include <ramses-logic/LogicEngine.h>
 
 namespace raco::ramses_base {
 /**
- * Alias for the [rlogic::LogicEngine].
- * If needed extend to a wrapper.
+ * Wrapper for the [rlogic::LogicEngine] owning the cache of compiled Lua scripts.
  */
-using LogicEngine = rlogic::LogicEngine;
+class LogicEngine : public rlogic::LogicEngine {
+public:
+	LogicEngine() : luaScriptCache_{*this} {}
+
+	LuaScriptCache& luaScriptCache() {
+		return luaScriptCache_;
+	}
+
+private:
+	LuaScriptCache luaScriptCache_;
+};
 }
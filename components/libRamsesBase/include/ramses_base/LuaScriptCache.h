@@ -0,0 +1,77 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include "core/EngineInterface.h"
+
+#include <ramses-logic/LogicEngine.h>
+#include <ramses-logic/LuaScript.h>
+
+#include <string>
+#include <unordered_map>
+
+namespace raco::ramses_base {
+
+/**
+ * Cache of parsed Lua script interfaces keyed by the hash of the script source.
+ *
+ * Parsing a script compiles it in the logic engine. The compiled script is kept until it is taken over by
+ * the LuaScriptAdaptor creating the engine object for the same source, so every script is only compiled once.
+ * Compiled scripts which are not taken must be released before the logic engine is updated or exported.
+ */
+class LuaScriptCache {
+public:
+	struct ScriptInterface {
+		bool success{false};
+		core::PropertyInterfaceList inputs;
+		core::PropertyInterfaceList outputs;
+		std::string error;
+	};
+
+	explicit LuaScriptCache(rlogic::LogicEngine& engine);
+	~LuaScriptCache();
+
+	LuaScriptCache(const LuaScriptCache&) = delete;
+	LuaScriptCache& operator=(const LuaScriptCache&) = delete;
+
+	// Return the interface of the script, compiling it only if the source is not in the cache yet.
+	const ScriptInterface& parse(const std::string& source);
+
+	// Take ownership of the script compiled by the last parse of the source.
+	// Returns nullptr if there is none; the caller has to compile the script itself then.
+	rlogic::LuaScript* takeCompiledScript(const std::string& source);
+
+	// Destroy all compiled scripts which have not been taken.
+	void releaseCompiledScripts();
+
+	size_t compileCount() const {
+		return compileCount_;
+	}
+	size_t hitCount() const {
+		return hitCount_;
+	}
+
+private:
+	struct Entry {
+		std::string source;
+		ScriptInterface scriptInterface;
+		rlogic::LuaScript* compiledScript{nullptr};
+	};
+
+	static constexpr size_t maxEntries = 1024;
+
+	rlogic::LogicEngine& engine_;
+	std::unordered_map<size_t, Entry> entries_;
+	size_t pendingScripts_{0};
+	size_t compileCount_{0};
+	size_t hitCount_{0};
+};
+
+}  // namespace raco::ramses_base
@@ -0,0 +1,80 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include "core/EngineInterface.h"
+
+#include <ramses-client-api/Scene.h>
+
+#include <string>
+#include <unordered_map>
+
+namespace raco::ramses_base {
+
+/**
+ * Cache of the uniform and attribute interfaces of shaders keyed by a SHA-256 digest of the shader sources and defines.
+ *
+ * Avoids compiling a ramses::Effect for shaders which have been parsed before. If a cache file is set the
+ * cache is loaded from and saved to disk, so the cache persists between application runs.
+ */
+class ShaderInterfaceCache {
+public:
+	struct ShaderInterface {
+		bool success{false};
+		core::PropertyInterfaceList uniforms;
+		core::PropertyInterfaceList attributes;
+		std::string error;
+	};
+
+	ShaderInterfaceCache() = default;
+	~ShaderInterfaceCache();
+
+	ShaderInterfaceCache(const ShaderInterfaceCache&) = delete;
+	ShaderInterfaceCache& operator=(const ShaderInterfaceCache&) = delete;
+
+	// Return the shader interface, parsing the shaders with parseShaderText only if they are not in the cache.
+	const ShaderInterface& parse(ramses::Scene& scene, const std::string& vertexShader, const std::string& geometryShader, const std::string& fragmentShader, const std::string& shaderDefines);
+
+	// Load the cache from the file and save it back to the same file on destruction.
+	void setCacheFile(const std::string& cacheFilePath);
+	bool save() const;
+
+	size_t size() const {
+		return entries_.size();
+	}
+	size_t hitCount() const {
+		return hitCount_;
+	}
+	size_t missCount() const {
+		return missCount_;
+	}
+
+	// SHA-256 digest identifying the combination of shader sources and defines.
+	static std::string computeDigest(const std::string& vertexShader, const std::string& geometryShader, const std::string& fragmentShader, const std::string& shaderDefines);
+
+private:
+	struct Entry {
+		ShaderInterface shaderInterface;
+		// Entries not used in the current session are dropped when saving a cache exceeding maxEntries.
+		bool used{false};
+	};
+
+	static constexpr size_t maxEntries = 4096;
+
+	bool load();
+
+	std::string cacheFilePath_;
+	std::unordered_map<std::string, Entry> entries_;
+	mutable bool modified_{false};
+	size_t hitCount_{0};
+	size_t missCount_{0};
+};
+
+}  // namespace raco::ramses_base
@@ -0,0 +1,126 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include "core/FileChangeMonitor.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace raco::ramses_base {
+
+struct DecodedImage {
+	unsigned int width{0};
+	unsigned int height{0};
+	// RGBA8 pixel data
+	std::vector<unsigned char> data;
+};
+
+using SharedDecodedImage = std::shared_ptr<const DecodedImage>;
+
+struct ImageRequest {
+	std::string absPath;
+	bool flipVertically{false};
+};
+
+/**
+ * Process-wide cache of decoded PNG images shared by all Texture and CubeMap adaptors.
+ *
+ * Entries are keyed by absolute path, file modification time and vertical flip, so several objects using the same
+ * image only decode it once. The least recently used entries are evicted when the cache exceeds its memory budget.
+ * If a file change monitor is set, entries are also dropped as soon as their file changes on disk.
+ * All functions are thread-safe.
+ */
+class TextureDataCache {
+public:
+	static constexpr size_t defaultMemoryBudget = 256 * 1024 * 1024;
+
+	static TextureDataCache& instance();
+
+	TextureDataCache() = default;
+	~TextureDataCache();
+
+	TextureDataCache(const TextureDataCache&) = delete;
+	TextureDataCache& operator=(const TextureDataCache&) = delete;
+
+	// Return the decoded RGBA8 image, flipped vertically if requested, or nullptr if the file can't be decoded.
+	SharedDecodedImage decodePng(const std::string& absPath, bool flipVertically);
+
+	// Decode all requested images which are not in the cache yet on a persistent pool of worker threads; the calling thread helps.
+	// Returns the images in request order, nullptr for images which couldn't be decoded.
+	// The caller has to keep the returned images: they may already be evicted from the cache if they exceed the memory budget.
+	std::vector<SharedDecodedImage> decodePngs(const std::vector<ImageRequest>& requests);
+
+	void invalidate(const std::string& absPath);
+	void clear();
+
+	// The monitor must be reset to nullptr before it is destroyed. File watches are only created and removed
+	// on the thread which set the monitor; images decoded on other threads are watched on its next call.
+	void setFileChangeMonitor(core::FileChangeMonitor* monitor);
+
+	void setMemoryBudget(size_t bytes);
+	size_t memoryBudget() const;
+
+	// Bytes of pixel data held by the cache; images still used by textures but evicted from the cache are not counted.
+	size_t bytesHeld() const;
+	size_t entryCount() const;
+	size_t hitCount() const;
+	size_t missCount() const;
+
+private:
+	using Key = std::tuple<std::string, int64_t, bool>;
+
+	struct Entry {
+		Key key;
+		SharedDecodedImage image;
+	};
+
+	static SharedDecodedImage decode(const std::string& absPath, bool flipVertically);
+	void insert(const Key& key, SharedDecodedImage image);
+	void evict(size_t budget);
+	void updateListeners();
+
+	void runWorker();
+	// Pop a decoding task from the queue; returns an empty function if the queue is empty.
+	std::function<void()> popTask();
+
+	mutable std::mutex mutex_;
+	// Most recently used entries first.
+	std::list<Entry> entries_;
+	std::map<Key, std::list<Entry>::iterator> index_;
+	std::map<std::string, core::FileChangeMonitor::UniqueListener> listeners_;
+	std::set<std::string> unwatchedPaths_;
+	core::FileChangeMonitor* fileChangeMonitor_{nullptr};
+	std::thread::id monitorThread_;
+	size_t memoryBudget_{defaultMemoryBudget};
+	size_t bytesHeld_{0};
+	size_t hitCount_{0};
+	size_t missCount_{0};
+
+	// Worker threads for decodePngs, started on first use.
+	std::vector<std::thread> workers_;
+	std::mutex queueMutex_;
+	std::condition_variable queueCondition_;
+	std::deque<std::function<void()>> queue_;
+	bool stopWorkers_{false};
+};
+
+}  // namespace raco::ramses_base
@@ -30,6 +30,7 @@ using PropertyInterfaceList = raco::core::PropertyInterfaceList;
 bool parseShaderText(ramses::Scene& scene, const std::string& vertexShader, const std::string& geometryShader, const std::string& fragmentShader, const std::string& shaderDefines, PropertyInterfaceList& outUniforms, raco::core::PropertyInterfaceList& outAttributes, std::string& outError);
 
 // Parse luascripts using ramses logic and return set of in and out parameters with name and type.
+// The result is cached in the LuaScriptCache of the logic engine.
 // Returns true if script can be successfully parsed.
 bool parseLuaScript(LogicEngine& engine, const std::string& luaScript, PropertyInterfaceList& outInputs, PropertyInterfaceList& outOutputs, std::string& outError);
 
@@ -14,6 +14,7 @@
 #include "ramses_adaptor/SceneAdaptor.h"
 #include "ramses_adaptor/TextureSamplerAdaptor.h"
 #include "ramses_base/RamsesHandles.h"
+#include "ramses_base/TextureDataCache.h"
 #include "user_types/CubeMap.h"
 #include "user_types/Enumerations.h"
 
@@ -43,8 +44,16 @@ CubeMapAdaptor::CubeMapAdaptor(SceneAdaptor* sceneAdaptor, std::shared_ptr<user_
 			  tagDirty();
 		  })} {}
 
+void CubeMapAdaptor::getPendingImages(std::vector<ramses_base::ImageRequest>& images) {
+	for (const auto& propName : {"uriFront", "uriBack", "uriLeft", "uriRight", "uriTop", "uriBottom"}) {
+		if (!editorObject()->get(propName)->asString().empty()) {
+			images.push_back({raco::core::PathQueries::resolveUriPropertyToAbsolutePath(sceneAdaptor_->project(), {editorObject(), {propName}}), false});
+		}
+	}
+}
+
 raco::ramses_base::RamsesTextureCube CubeMapAdaptor::createTexture(core::Errors* errors) {
-	std::map<std::string, std::vector<unsigned char>> data;
+	std::map<std::string, raco::ramses_base::SharedDecodedImage> data;
 	unsigned int width = -1;
 	unsigned int height = -1;
 
@@ -53,9 +62,10 @@ raco::ramses_base::RamsesTextureCube CubeMapAdaptor::createTexture(core::Errors*
 	for (const auto& propName : {"uriFront", "uriBack", "uriLeft", "uriRight", "uriTop", "uriBottom"}) {
 		std::string uri = editorObject()->get(propName)->asString();
 		if (!uri.empty()) {
-			unsigned int curWidth;
-			unsigned int curHeight;
-			if (0 == lodepng::decode(data[propName], curWidth, curHeight, raco::core::PathQueries::resolveUriPropertyToAbsolutePath(sceneAdaptor_->project(), {editorObject(), {propName}}))) {
+			data[propName] = sceneAdaptor_->decodeImage(raco::core::PathQueries::resolveUriPropertyToAbsolutePath(sceneAdaptor_->project(), {editorObject(), {propName}}), false);
+			if (data[propName]) {
+				unsigned int curWidth = data[propName]->width;
+				unsigned int curHeight = data[propName]->height;
 				if (curWidth != curHeight) {
 					LOG_ERROR(raco::log_system::RAMSES_ADAPTOR, "CubeMap '{}': non-square image '{}' for '{}'", editorObject()->objectName(), uri, propName);
 					errors->addError(core::ErrorCategory::PARSE_ERROR, core::ErrorLevel::ERROR, {editorObject()->shared_from_this(), {propName}},
@@ -89,13 +99,13 @@ raco::ramses_base::RamsesTextureCube CubeMapAdaptor::createTexture(core::Errors*
 	}
 
 	// Order: +x, -X, +Y, -Y, +Z, -Z
-	ramses::CubeMipLevelData mipData = ramses::CubeMipLevelData((uint32_t)data["uriRight"].size(),
-		data["uriRight"].data(),
-		data["uriLeft"].data(),
-		data["uriTop"].data(),
-		data["uriBottom"].data(),
-		data["uriFront"].data(),
-		data["uriBack"].data());
+	ramses::CubeMipLevelData mipData = ramses::CubeMipLevelData((uint32_t)data["uriRight"]->data.size(),
+		data["uriRight"]->data.data(),
+		data["uriLeft"]->data.data(),
+		data["uriTop"]->data.data(),
+		data["uriBottom"]->data.data(),
+		data["uriFront"]->data.data(),
+		data["uriBack"]->data.data());
 
 	return raco::ramses_base::ramsesTextureCube(sceneAdaptor_->scene(), ramses::ETextureFormat::RGBA8, width, 1u, &mipData, false, {}, ramses::ResourceCacheFlag_DoNotCache);
 }
@@ -60,11 +60,13 @@ LinkAdaptor::LinkAdaptor(const core::LinkDescriptor& link, SceneAdaptor* sceneAd
 void LinkAdaptor::lift() {
 	LOG_TRACE(log_system::RAMSES_ADAPTOR, "{}", editorLink_);
 	engineLink_.clear();
+	outputSnapshot_.reset();
 }
 
 void LinkAdaptor::connect() {
 	LOG_TRACE(log_system::RAMSES_ADAPTOR, "{}", editorLink_);
 	engineLink_.clear();
+	outputSnapshot_.reset();
 
 	auto originAdaptor{sceneAdaptor_->lookupAdaptor(editorLink_.start.object())};
 	auto destAdaptor{sceneAdaptor_->lookupAdaptor(editorLink_.end.object())};
@@ -85,15 +87,25 @@ void LinkAdaptor::connect() {
 	}
 }
 
-void LinkAdaptor::readDataFromEngine(core::DataChangeRecorder& recorder) {
-	auto destAdaptor{sceneAdaptor_->lookupAdaptor(editorLink_.end.object())};
-	raco::core::ValueHandle destHandle{editorLink_.end};
-	if (destAdaptor && destHandle && editorLink_.isValid) {
-		auto endProp = dynamic_cast<ILogicPropertyProvider*>(destAdaptor)->getProperty(editorLink_.end.propertyNames());
-		if (endProp) {
-			getLuaOutputFromEngine(*endProp, destHandle, recorder);
+void LinkAdaptor::readDataFromEngine(core::DataChangeRecorder& recorder, LogicReadbackStatistics& statistics) {
+	if (engineLink_.empty()) {
+		return;
+	}
+	if (outputSnapshot_.empty()) {
+		auto destAdaptor{sceneAdaptor_->lookupAdaptor(editorLink_.end.object())};
+		raco::core::ValueHandle destHandle{editorLink_.end};
+		if (destAdaptor && destHandle && editorLink_.isValid) {
+			auto endProp = dynamic_cast<ILogicPropertyProvider*>(destAdaptor)->getProperty(editorLink_.end.propertyNames());
+			if (endProp) {
+				outputSnapshot_.build(*endProp, destHandle);
+			}
 		}
 	}
+	outputSnapshot_.readDataFromEngine(recorder, statistics);
+}
+
+void LinkAdaptor::resetOutputSnapshot() {
+	outputSnapshot_.reset();
 }
 
 }  // namespace raco::ramses_adaptor
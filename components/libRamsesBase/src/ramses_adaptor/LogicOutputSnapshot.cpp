@@ -0,0 +1,151 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "ramses_adaptor/LogicOutputSnapshot.h"
+
+#include "ramses_adaptor/utilities.h"
+
+namespace raco::ramses_adaptor {
+
+namespace {
+
+// Read the engine value and update the cached value; returns true if the value differs from the cached one.
+template <typename T, typename CachedValue>
+bool updateCachedValue(const rlogic::Property& property, CachedValue& cached, T& outValue) {
+	outValue = property.get<T>().value();
+	if (auto cachedValue = std::get_if<T>(&cached); cachedValue && *cachedValue == outValue) {
+		return false;
+	}
+	cached = outValue;
+	return true;
+}
+
+}  // namespace
+
+void LogicOutputSnapshot::reset() {
+	leaves_.clear();
+	valid_ = false;
+}
+
+void LogicOutputSnapshot::build(const rlogic::Property& property, const core::ValueHandle& valueHandle) {
+	reset();
+	addLeaves(property, valueHandle);
+	valid_ = true;
+}
+
+void LogicOutputSnapshot::addLeaves(const rlogic::Property& property, const core::ValueHandle& valueHandle) {
+	using core::PrimitiveType;
+	switch (valueHandle.type()) {
+		case PrimitiveType::Table:
+		case PrimitiveType::Struct:
+			for (size_t i{0}; i < valueHandle.size(); i++) {
+				if (property.getType() == rlogic::EPropertyType::Array) {
+					addLeaves(*property.getChild(i), valueHandle[i]);
+				} else {
+					addLeaves(*property.getChild(valueHandle[i].getPropName()), valueHandle[i]);
+				}
+			}
+			break;
+		case PrimitiveType::Ref:
+			break;
+		default:
+			leaves_.push_back({&property, valueHandle, std::monostate{}});
+			break;
+	}
+}
+
+void LogicOutputSnapshot::readDataFromEngine(core::DataChangeRecorder& recorder, LogicReadbackStatistics& statistics) {
+	using core::PrimitiveType;
+	statistics.propertiesRead += leaves_.size();
+
+	for (auto& leaf : leaves_) {
+		const auto& property = *leaf.property;
+		const auto& handle = leaf.valueHandle;
+		size_t componentsWritten = 0;
+		switch (handle.type()) {
+			case PrimitiveType::Double: {
+				float value;
+				if (updateCachedValue(property, leaf.value, value)) {
+					componentsWritten = ReadFromEngineManager::setValueFromEngineValue<double>(handle, value, recorder);
+				}
+				break;
+			}
+			case PrimitiveType::Int: {
+				int32_t value;
+				if (updateCachedValue(property, leaf.value, value)) {
+					componentsWritten = ReadFromEngineManager::setValueFromEngineValue(handle, static_cast<int>(value), recorder);
+				}
+				break;
+			}
+			case PrimitiveType::Bool: {
+				bool value;
+				if (updateCachedValue(property, leaf.value, value)) {
+					componentsWritten = ReadFromEngineManager::setValueFromEngineValue(handle, value, recorder);
+				}
+				break;
+			}
+			case PrimitiveType::Vec2f: {
+				rlogic::vec2f value;
+				if (updateCachedValue(property, leaf.value, value)) {
+					componentsWritten = ReadFromEngineManager::setVec2f(handle, value[0], value[1], recorder);
+				}
+				break;
+			}
+			case PrimitiveType::Vec3f: {
+				rlogic::vec3f value;
+				if (updateCachedValue(property, leaf.value, value)) {
+					componentsWritten = ReadFromEngineManager::setVec3f(handle, value[0], value[1], value[2], recorder);
+				}
+				break;
+			}
+			case PrimitiveType::Vec4f: {
+				rlogic::vec4f value;
+				if (updateCachedValue(property, leaf.value, value)) {
+					componentsWritten = ReadFromEngineManager::setVec4f(handle, value[0], value[1], value[2], value[3], recorder);
+				}
+				break;
+			}
+			case PrimitiveType::Vec2i: {
+				rlogic::vec2i value;
+				if (updateCachedValue(property, leaf.value, value)) {
+					componentsWritten = ReadFromEngineManager::setVec2i(handle, value[0], value[1], recorder);
+				}
+				break;
+			}
+			case PrimitiveType::Vec3i: {
+				rlogic::vec3i value;
+				if (updateCachedValue(property, leaf.value, value)) {
+					componentsWritten = ReadFromEngineManager::setVec3i(handle, value[0], value[1], value[2], recorder);
+				}
+				break;
+			}
+			case PrimitiveType::Vec4i: {
+				rlogic::vec4i value;
+				if (updateCachedValue(property, leaf.value, value)) {
+					componentsWritten = ReadFromEngineManager::setVec4i(handle, value[0], value[1], value[2], value[3], recorder);
+				}
+				break;
+			}
+			case PrimitiveType::String: {
+				std::string value;
+				if (updateCachedValue(property, leaf.value, value)) {
+					componentsWritten = ReadFromEngineManager::setValueFromEngineValue(handle, value, recorder);
+				}
+				break;
+			}
+			default:
+				break;
+		}
+		if (componentsWritten > 0) {
+			++statistics.propertiesWritten;
+		}
+	}
+}
+
+}  // namespace raco::ramses_adaptor
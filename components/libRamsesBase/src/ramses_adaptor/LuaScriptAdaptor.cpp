@@ -13,7 +13,6 @@
 #include "ramses_adaptor/utilities.h"
 #include "ramses_base/LogicEngineFormatter.h"
 #include "user_types/PrefabInstance.h"
-#include "utils/FileUtils.h"
 
 namespace raco::ramses_adaptor {
 
@@ -86,11 +85,18 @@ bool LuaScriptAdaptor::sync(core::Errors* errors) {
 	ObjectAdaptor::sync(errors);
 
 	if (recreateStatus_) {
-		auto scriptContent = utils::file::read(raco::core::PathQueries::resolveUriPropertyToAbsolutePath(sceneAdaptor_->project(), {editorObject_, {"uri"}}));
+		const auto& scriptContent = editorObject_->currentScriptContents();
 		LOG_TRACE(log_system::RAMSES_ADAPTOR, "{}: {}", generateRamsesObjectName(), scriptContent);
+		outputSnapshot_.reset();
 		luaScript_.reset();
 		if (!scriptContent.empty()) {
-			auto ptr = sceneAdaptor_->logicEngine().createLuaScriptFromSource(scriptContent, generateRamsesObjectName());
+			// Reuse the script compiled while parsing the script interface if it has not been taken yet.
+			auto ptr = sceneAdaptor_->logicEngine().luaScriptCache().takeCompiledScript(scriptContent);
+			if (ptr) {
+				ptr->setName(generateRamsesObjectName());
+			} else {
+				ptr = sceneAdaptor_->logicEngine().createLuaScriptFromSource(scriptContent, generateRamsesObjectName());
+			}
 			LOG_TRACE(log_system::RAMSES_ADAPTOR, "create: {}", fmt::ptr(ptr));
 			if (ptr) {
 				luaScript_ = {
@@ -117,13 +123,19 @@ bool LuaScriptAdaptor::sync(core::Errors* errors) {
 	return true;
 }
 
-void LuaScriptAdaptor::readDataFromEngine(core::DataChangeRecorder &recorder) {
+void LuaScriptAdaptor::readDataFromEngine(core::DataChangeRecorder& recorder, LogicReadbackStatistics& statistics) {
 	if (luaScript_) {
-		core::ValueHandle luaOutputs{editorObject_, {"luaOutputs"}};
-		getLuaOutputFromEngine(*luaScript_->getOutputs(), luaOutputs, recorder);
+		if (outputSnapshot_.empty()) {
+			outputSnapshot_.build(*luaScript_->getOutputs(), core::ValueHandle{editorObject_, {"luaOutputs"}});
+		}
+		outputSnapshot_.readDataFromEngine(recorder, statistics);
 	}
 }
 
+void LuaScriptAdaptor::resetOutputSnapshot() {
+	outputSnapshot_.reset();
+}
+
 const rlogic::Property* LuaScriptAdaptor::getProperty(const std::vector<std::string>& names) {
 	const rlogic::Property* prop{names.at(0) == "luaInputs" ? luaScript_->getInputs() : luaScript_->getOutputs()};
 	for (size_t i{1}; i < names.size(); i++) {
@@ -14,6 +14,7 @@
 #include "ramses_adaptor/ObjectAdaptor.h"
 #include "ramses_adaptor/SceneAdaptor.h"
 #include "ramses_adaptor/TextureSamplerAdaptor.h"
+#include "ramses_base/ShaderInterfaceCache.h"
 #include "ramses_base/Utils.h"
 #include "user_types/EngineTypeAnnotation.h"
 #include "user_types/Material.h"
@@ -41,6 +42,11 @@ raco::ramses_base::RamsesEffect MaterialAdaptor::createEffect(SceneAdaptor* scen
 MaterialAdaptor::MaterialAdaptor(SceneAdaptor* sceneAdaptor, user_types::SMaterial material)
 	: TypedObjectAdaptor{sceneAdaptor, material, createEffect(sceneAdaptor)},
 	  subscription_{sceneAdaptor_->dispatcher()->registerOnPreviewDirty(editorObject(), [this]() {
+		  effectStatus_ = true;
+		  tagDirty();
+	  })},
+	  nameSubscription_{sceneAdaptor_->dispatcher()->registerOn({editorObject(), {"objectName"}}, [this]() {
+		  recreateStatus_ = true;
 		  tagDirty();
 	  })},
 	  optionsSubscription_{sceneAdaptor_->dispatcher()->registerOnChildren({editorObject(), {"options"}}, [this](auto) {
@@ -55,39 +61,73 @@ bool MaterialAdaptor::isValid() {
 	return editorObject()->isShaderValid();
 }
 
-bool MaterialAdaptor::sync(core::Errors* errors) {
-	bool status = TypedObjectAdaptor<user_types::Material, ramses::Effect>::sync(errors);
-	LOG_TRACE(raco::log_system::RAMSES_ADAPTOR, "valid: {}", isValid());
+bool MaterialAdaptor::syncEffect() {
+	std::optional<std::string> effectKey;
+	std::string vertexShader;
+	std::string fragmentShader;
+	std::string geometryShader;
+	std::string shaderDefines;
+	if (editorObject()->isShaderValid()) {
+		vertexShader = utils::file::read(raco::core::PathQueries::resolveUriPropertyToAbsolutePath(sceneAdaptor_->project(), {editorObject(), {"uriVertex"}}));
+		fragmentShader = utils::file::read(raco::core::PathQueries::resolveUriPropertyToAbsolutePath(sceneAdaptor_->project(), {editorObject(), {"uriFragment"}}));
+		geometryShader = utils::file::read(raco::core::PathQueries::resolveUriPropertyToAbsolutePath(sceneAdaptor_->project(), {editorObject(), {"uriGeometry"}}));
+		shaderDefines = utils::file::read(raco::core::PathQueries::resolveUriPropertyToAbsolutePath(sceneAdaptor_->project(), {editorObject(), {"uriDefines"}}));
+		effectKey = raco::ramses_base::ShaderInterfaceCache::computeDigest(vertexShader, geometryShader, fragmentShader, shaderDefines);
+	}
+
+	if (effectKey == effectKey_) {
+		return false;
+	}
 
 	appearanceBinding_.reset();
 	appearance_.reset();
 
-	if (editorObject()->isShaderValid()) {
-		std::string const vertexShader = utils::file::read(raco::core::PathQueries::resolveUriPropertyToAbsolutePath(sceneAdaptor_->project(), {editorObject(), {"uriVertex"}}));
-		std::string const fragmentShader = utils::file::read(raco::core::PathQueries::resolveUriPropertyToAbsolutePath(sceneAdaptor_->project(), {editorObject(), {"uriFragment"}}));
-		std::string const geometryShader = utils::file::read(raco::core::PathQueries::resolveUriPropertyToAbsolutePath(sceneAdaptor_->project(), {editorObject(), {"uriGeometry"}}));
-		std::string const shaderDefines = utils::file::read(raco::core::PathQueries::resolveUriPropertyToAbsolutePath(sceneAdaptor_->project(), {editorObject(), {"uriDefines"}}));
+	if (effectKey) {
 		auto const effectDescription = raco::ramses_base::createEffectDescription(vertexShader, geometryShader, fragmentShader, shaderDefines);
 		reset(raco::ramses_base::ramsesEffect(sceneAdaptor_->scene(), *effectDescription));
+		effectCreationCount_++;
 	} else {
 		reset(createEffect(sceneAdaptor_));
 	}
+	effectKey_ = effectKey;
+	return true;
+}
 
-	appearance_ = raco::ramses_base::ramsesAppearance(sceneAdaptor_->scene(), getRamsesObjectPointer());
-	(*appearance_)->setName(std::string(this->editorObject()->objectName() + "_Appearance").c_str());
+bool MaterialAdaptor::sync(core::Errors* errors) {
+	TypedObjectAdaptor<user_types::Material, ramses::Effect>::sync(errors);
+	LOG_TRACE(raco::log_system::RAMSES_ADAPTOR, "valid: {}", isValid());
+
+	// The effect is only recreated if the shader sources changed. Uniform and option changes are applied to the
+	// existing appearance, keeping the ramses objects used by the MeshNodes.
+	bool recreate = recreateStatus_ || !appearance_;
+	if (effectStatus_ && syncEffect()) {
+		recreate = true;
+	}
+
+	if (recreate) {
+		appearanceBinding_.reset();
+		appearance_.reset();
+
+		appearance_ = raco::ramses_base::ramsesAppearance(sceneAdaptor_->scene(), getRamsesObjectPointer());
+		(*appearance_)->setName(std::string(this->editorObject()->objectName() + "_Appearance").c_str());
+	}
 
 	// Only create appearance binding and set uniforms & blend options if we are using a valid shader but not if
 	// we are using the empty default shaders.
-	if (editorObject()->isShaderValid()) {
+	if (effectKey_) {
 		core::ValueHandle optionsHandle = {editorObject(), {"options"}};
 		core::ValueHandle uniformsHandle = {editorObject(), {"uniforms"}};
 		updateAppearance(sceneAdaptor_, appearance_, optionsHandle, uniformsHandle);
 
-		appearanceBinding_ = raco::ramses_base::ramsesAppearanceBinding(*appearance_->get(), & sceneAdaptor_->logicEngine(), editorObject()->objectName() + "_AppearanceBinding");
+		if (recreate) {
+			appearanceBinding_ = raco::ramses_base::ramsesAppearanceBinding(*appearance_->get(), &sceneAdaptor_->logicEngine(), editorObject()->objectName() + "_AppearanceBinding");
+		}
 	}
 
+	effectStatus_ = false;
+	recreateStatus_ = false;
 	tagDirty(false);
-	return true;
+	return recreate;
 }
 
 void MaterialAdaptor::getLogicNodes(std::vector<rlogic::LogicNode*>& logicNodes) const {
@@ -15,12 +15,23 @@
 #include "ramses_adaptor/utilities.h"
 #include "ramses_base/RamsesHandles.h"
 #include "user_types/Mesh.h"
+#include <limits>
 #include <unordered_map>
+#include <vector>
 
 namespace raco::ramses_adaptor {
 
 using namespace raco::ramses_base;
 
+raco::ramses_base::RamsesArrayResource MeshAdaptor::createIndexResource(ramses::Scene* scene, const core::MeshData& mesh) {
+	auto indices = mesh.getIndices();
+	if (mesh.numVertices() <= std::numeric_limits<uint16_t>::max() + 1u) {
+		std::vector<uint16_t> shortIndices(indices.begin(), indices.end());
+		return ramsesArrayResource(scene, ramses::EDataType::UInt16, static_cast<uint32_t>(shortIndices.size()), shortIndices.data());
+	}
+	return ramsesArrayResource(scene, ramses::EDataType::UInt32, static_cast<uint32_t>(indices.size()), indices.data());
+}
+
 MeshAdaptor::MeshAdaptor(SceneAdaptor* sceneAdaptor, user_types::SMesh mesh)
 	: ObjectAdaptor{sceneAdaptor},
 	  editorObject_{mesh},
@@ -48,29 +59,41 @@ bool MeshAdaptor::isValid() {
 bool MeshAdaptor::sync(core::Errors* errors) {
 	ObjectAdaptor::sync(errors);
 	LOG_TRACE(raco::log_system::RAMSES_ADAPTOR, "{}", isValid());
-	if (isValid()) {
-		auto mesh = editorObject_->meshData();
-		auto indices = mesh->getIndices();
-		indices_ = ramsesArrayResource(sceneAdaptor_->scene(), ramses::EDataType::UInt32, static_cast<uint32_t>(indices.size()), indices.data());
-		indices_->setName(std::string(this->editorObject_->objectName() + "_MeshIndexData").c_str());
-
+	auto mesh = editorObject_->meshData();
+	if (mesh && mesh == syncedMesh_) {
+		// Only the name changed: keep the existing resources instead of uploading the buffers again.
+		setResourceNames(*mesh);
+		tagDirty(false);
+		return false;
+	}
+	syncedMesh_ = mesh;
+	vertexDataMap_.clear();
+	if (mesh) {
+		// The vertex buffers are passed to Ramses straight from the MeshData without intermediate copies.
+		indices_ = createIndexResource(sceneAdaptor_->scene(), *mesh);
 
 		for (uint32_t i{0}; i < mesh->numAttributes(); i++) {
-			auto name = mesh->attribName(i);
 			auto type = mesh->attribDataType(i);
 			auto buffer = mesh->attribBuffer(i);
 			auto elementCount = mesh->attribElementCount(i);
-			vertexDataMap_[name] = ramsesArrayResource(sceneAdaptor_->scene(), convert(type), elementCount, buffer);
-			vertexDataMap_[name]->setName(std::string(this->editorObject_->objectName() + "_MeshVertexData_" + name).c_str());
+			vertexDataMap_[mesh->attribName(i)] = ramsesArrayResource(sceneAdaptor_->scene(), convert(type), elementCount, buffer);
 		}
+		setResourceNames(*mesh);
 	} else {
-		vertexDataMap_.clear();
 		indices_.reset();
 	}
 	tagDirty(false);
 	return true;
 }
 
+void MeshAdaptor::setResourceNames(const core::MeshData& mesh) {
+	indices_->setName(std::string(this->editorObject_->objectName() + "_MeshIndexData").c_str());
+	for (uint32_t i{0}; i < mesh.numAttributes(); i++) {
+		auto name = mesh.attribName(i);
+		vertexDataMap_[name]->setName(std::string(this->editorObject_->objectName() + "_MeshVertexData_" + name).c_str());
+	}
+}
+
 core::SEditorObject MeshAdaptor::baseEditorObject() noexcept {
 	return editorObject_;
 }
@@ -25,6 +25,7 @@
 #include <spdlog/fmt/fmt.h>
 
 #include <algorithm>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <unordered_set>
@@ -85,7 +86,15 @@ SceneAdaptor::SceneAdaptor(ramses::RamsesClient* client, ramses_base::LogicEngin
 	  project_(project),
 	  scene_{ramsesScene(id, client_)},
 	  defaultRenderGroup_{ramsesRenderGroup(scene_.get())},
-	  subscription_{dispatcher->registerOnObjectsLifeCycle([this](SEditorObject obj) { createAdaptor(obj); }, [this](SEditorObject obj) { removeAdaptor(obj); })},
+	  subscription_{dispatcher->registerOnObjectsLifeCycle(
+		  [this](SEditorObject obj) {
+			  addDependencyNode(obj);
+			  createAdaptor(obj);
+		  },
+		  [this](SEditorObject obj) {
+			  removeAdaptor(obj);
+			  removeDependencyNode(obj);
+		  })},
 	  linksLifecycle_{dispatcher->registerOnLinksLifeCycle(
 		  [this](const core::LinkDescriptor& link) { createLink(link); },
 		  [this](const core::LinkDescriptor& link) { removeLink(link); })},
@@ -93,10 +102,14 @@ SceneAdaptor::SceneAdaptor(ramses::RamsesClient* client, ramses_base::LogicEngin
 		  [this](const core::LinkDescriptor& link) {
 			changeLinkValidity(link, link.isValid); })},
 	  dispatcher_{dispatcher},
-	  errors_{errors} {
+	  errors_{errors},
+	  childrenSubscription_{dispatcher->registerOnPropertyChange("children", [this](core::ValueHandle handle) {
+		  renderGroupDirty_ = true;
+	  })} {
 	defaultRenderGroup_->setName(defaultRenderGroupName);
 
 	for (const SEditorObject& obj : project_->instances()) {
+		addDependencyNode(obj);
 		createAdaptor(obj);
 	}
 
@@ -131,13 +144,32 @@ void SceneAdaptor::createAdaptor(SEditorObject obj) {
 	auto adaptor = Factories::createAdaptor(this, obj);
 	if (adaptor) {
 		adaptor->tagDirty();
+		if (auto logicPropertyProvider = dynamic_cast<ILogicPropertyProvider*>(adaptor.get())) {
+			logicPropertyProviders_[obj] = logicPropertyProvider;
+		}
+		if (auto logicOutputProvider = dynamic_cast<ILogicOutputProvider*>(adaptor.get())) {
+			logicOutputProviders_[obj] = logicOutputProvider;
+		}
+		if (auto imageProvider = dynamic_cast<IImageProvider*>(adaptor.get())) {
+			imageProviders_[obj] = imageProvider;
+		}
 		adaptors_[obj] = std::move(adaptor);
 	}
 }
 
 void SceneAdaptor::removeAdaptor(SEditorObject obj) {
-	auto adaptorWasLogicProvider = dynamic_cast<ILogicPropertyProvider*>(lookupAdaptor(obj)) != nullptr;
+	auto adaptorWasLogicProvider = logicPropertyProviders_.erase(obj) > 0;
+	logicOutputProviders_.erase(obj);
+	imageProviders_.erase(obj);
+	auto linksIt = linksByObject_.find(obj);
+	if (linksIt != linksByObject_.end()) {
+		for (auto link : linksIt->second) {
+			link->resetOutputSnapshot();
+		}
+	}
 	adaptors_.erase(obj);
+	dirtyObjects_.erase(obj);
+	renderGroupDirty_ = true;
 	deleteUnusedDefaultResources();
 	if (adaptorWasLogicProvider) {
 		updateRuntimeErrorList();
@@ -167,44 +199,44 @@ void SceneAdaptor::updateRuntimeErrorList() {
 	});
 	std::unordered_set<ILogicPropertyProvider*> logicProvidersWithoutRuntimeError;
 	std::string runtimeErrorObjectNames;
-	for (const auto& instance : project().instances()) {
-		if (auto logicProvider = dynamic_cast<ILogicPropertyProvider*>(lookupAdaptor(instance))) {
-			std::vector<rlogic::LogicNode*> logicNodes;
-			logicProvider->getLogicNodes(logicNodes);
-			rlogic::ErrorData const* runtimeError = nullptr;
-			for (auto logicNode : logicNodes) {
-				auto const itRuntimeErrorForScript = std::lower_bound(logicEngineErrors.begin(), logicEngineErrors.end(), logicNode, [](rlogic::ErrorData const& e, rlogic::LogicNode* s) {
-					return e.node < s;
-				});
-				if (itRuntimeErrorForScript != logicEngineErrors.end() && itRuntimeErrorForScript->node == logicNode) {
-					runtimeError = &*itRuntimeErrorForScript;
-					break;
-				}
+	std::vector<rlogic::LogicNode*> logicNodes;
+	for (const auto& [instance, logicProvider] : logicPropertyProviders_) {
+		logicNodes.clear();
+		logicProvider->getLogicNodes(logicNodes);
+		rlogic::ErrorData const* runtimeError = nullptr;
+		for (auto logicNode : logicNodes) {
+			auto const itRuntimeErrorForScript = std::lower_bound(logicEngineErrors.begin(), logicEngineErrors.end(), logicNode, [](rlogic::ErrorData const& e, rlogic::LogicNode* s) {
+				return e.node < s;
+			});
+			if (itRuntimeErrorForScript != logicEngineErrors.end() && itRuntimeErrorForScript->node == logicNode) {
+				runtimeError = &*itRuntimeErrorForScript;
+				break;
 			}
-			if (runtimeError != nullptr) {
-				runtimeErrorObjectNames.append("\n'" + instance->objectName() + "'");
-
-				// keep the old runtime error message if it is identical to the new message to prevent unnecessary error regeneration in the UI
-				if (errors_->hasError(instance)) {
-					auto instError = errors_->getError(instance);
-					if (instError.category() == core::ErrorCategory::RAMSES_LOGIC_RUNTIME_ERROR && instError.message() != runtimeError->message) {
-						errors_->removeError(instance);
-					}
+		}
+		if (runtimeError != nullptr) {
+			runtimeErrorObjectNames.append("\n'" + instance->objectName() + "'");
+
+			// keep the old runtime error message if it is identical to the new message to prevent unnecessary error regeneration in the UI
+			if (errors_->hasError(instance)) {
+				auto instError = errors_->getError(instance);
+				if (instError.category() == core::ErrorCategory::RAMSES_LOGIC_RUNTIME_ERROR && instError.message() != runtimeError->message) {
+					errors_->removeError(instance);
 				}
-				logicProvider->onRuntimeError(*errors_, runtimeError->message, core::ErrorLevel::ERROR);
-			} else {
-				logicProvidersWithoutRuntimeError.emplace(logicProvider);
 			}
+			logicProvider->onRuntimeError(*errors_, runtimeError->message, core::ErrorLevel::ERROR);
+		} else {
+			logicProvidersWithoutRuntimeError.emplace(logicProvider);
 		}
 	}
 
 	// keep the old runtime error info message if it is identical to the new message to prevent unnecessary error regeneration in the UI
 	auto ramsesLogicErrorFoundMsg = fmt::format("Ramses logic engine detected a runtime error in{}\nBe aware that some Lua script outputs and/or linked properties might not have been updated.", runtimeErrorObjectNames);
 	errors_->removeIf([this, &ramsesLogicErrorFoundMsg, &logicProvidersWithoutRuntimeError](const core::ErrorItem& errorItem) {
-		if (auto logicProvider = dynamic_cast<ILogicPropertyProvider*>(lookupAdaptor(errorItem.valueHandle().rootObject()))) {
-			return logicProvidersWithoutRuntimeError.count(logicProvider) == 1 && errorItem.category() == core::ErrorCategory::RAMSES_LOGIC_RUNTIME_ERROR && errorItem.message() != ramsesLogicErrorFoundMsg;
+		if (errorItem.category() != core::ErrorCategory::RAMSES_LOGIC_RUNTIME_ERROR || errorItem.message() == ramsesLogicErrorFoundMsg) {
+			return false;
 		}
-		return false;
+		auto it = logicPropertyProviders_.find(errorItem.valueHandle().rootObject());
+		return it != logicPropertyProviders_.end() && logicProvidersWithoutRuntimeError.count(it->second) == 1;
 	});
 
 
@@ -239,18 +271,31 @@ void SceneAdaptor::deleteUnusedDefaultResources() {
 void SceneAdaptor::readDataFromEngine(core::DataChangeRecorder& recorder) {
 	updateRuntimeErrorList();
 
+	readbackStatistics_ = {};
 	for (const auto& [link, adaptor] : links_) {
-		adaptor->readDataFromEngine(recorder);
+		adaptor->readDataFromEngine(recorder, readbackStatistics_);
 	}
-	for (const auto& adaptor : adaptors_) {
-		if (adaptor.first->getTypeDescription().typeName == user_types::LuaScript::typeDescription.typeName) {
-			static_cast<LuaScriptAdaptor*>(adaptor.second.get())->readDataFromEngine(recorder);
-		}
+	for (const auto& [object, outputProvider] : logicOutputProviders_) {
+		outputProvider->readDataFromEngine(recorder, readbackStatistics_);
 	}
 }
 
+const LogicReadbackStatistics& SceneAdaptor::readbackStatistics() const {
+	return readbackStatistics_;
+}
+
+size_t SceneAdaptor::bulkUpdateVisitedObjects() const {
+	return bulkUpdateVisitedObjects_;
+}
+
 void SceneAdaptor::createLink(const core::LinkDescriptor& link) {
-	links_[link] = std::make_unique<LinkAdaptor>(link, this);
+	auto it = links_.find(link);
+	if (it != links_.end()) {
+		removeLinkFromIndex(link, it->second.get());
+	}
+	auto& adaptor = links_[link];
+	adaptor = std::make_unique<LinkAdaptor>(link, this);
+	addLinkToIndex(link, adaptor.get());
 }
 
 void SceneAdaptor::changeLinkValidity(const core::LinkDescriptor& link, bool isValid) {
@@ -261,9 +306,27 @@ void SceneAdaptor::changeLinkValidity(const core::LinkDescriptor& link, bool isV
 void SceneAdaptor::removeLink(const core::LinkDescriptor& link) {
 	auto it = links_.find(link);
 	assert(it != links_.end());
+	removeLinkFromIndex(link, it->second.get());
 	links_.erase(it);
 }
 
+void SceneAdaptor::addLinkToIndex(const core::LinkDescriptor& link, LinkAdaptor* adaptor) {
+	linksByObject_[link.start.object()].insert(adaptor);
+	linksByObject_[link.end.object()].insert(adaptor);
+}
+
+void SceneAdaptor::removeLinkFromIndex(const core::LinkDescriptor& link, LinkAdaptor* adaptor) {
+	for (const auto& object : {link.start.object(), link.end.object()}) {
+		auto it = linksByObject_.find(object);
+		if (it != linksByObject_.end()) {
+			it->second.erase(adaptor);
+			if (it->second.empty()) {
+				linksByObject_.erase(it);
+			}
+		}
+	}
+}
+
 ramses::RamsesClient* SceneAdaptor::client() {
 	return client_;
 }
@@ -346,47 +409,140 @@ raco::core::Project& SceneAdaptor::project() const {
 	return *project_;
 }
 
-void SceneAdaptor::depthFirstSearch(data_storage::ReflectionInterface* object, DependencyNode& item, std::set<SEditorObject> const& instances, std::set<SEditorObject>& sortedObjs, std::vector<DependencyNode>& outSorted) {
+void SceneAdaptor::markAdaptorDirty(const core::SEditorObject& editorObject) {
+	if (editorObject) {
+		dirtyObjects_.insert(editorObject);
+	}
+}
+
+void SceneAdaptor::addDependencyNode(SEditorObject object) {
+	// New objects don't have any references yet; these are added by the bulk update which will
+	// always contain the created objects in its set of changed objects.
+	auto [it, inserted] = dependencyGraph_.emplace(object, DependencyNode{object, nextDependencyOrder_});
+	if (inserted) {
+		++nextDependencyOrder_;
+	}
+	renderGroupDirty_ = true;
+}
+
+void SceneAdaptor::removeDependencyNode(SEditorObject object) {
+	auto it = dependencyGraph_.find(object);
+	if (it == dependencyGraph_.end()) {
+		return;
+	}
+	// Removing edges never violates the topological order, so no reordering is needed here.
+	for (const auto& referenced : it->second.referencedObjects) {
+		dependencyGraph_.at(referenced).referencingObjects.erase(object);
+	}
+	for (const auto& referencing : it->second.referencingObjects) {
+		dependencyGraph_.at(referencing).referencedObjects.erase(object);
+	}
+	dependencyGraph_.erase(it);
+}
 
-	for (size_t index = 0; index < object->size(); index++) {
-		auto v = (*object)[index];
+void SceneAdaptor::collectReferencedObjects(const data_storage::ReflectionInterface& object, std::set<SEditorObject>& outReferenced) const {
+	for (size_t index = 0; index < object.size(); index++) {
+		auto v = object.get(index);
 		switch (v->type()) {
 			case data_storage::PrimitiveType::Ref: {
 				auto refValue = v->asRef();
-				if (refValue && instances.find(refValue) != instances.end()) {
-					depthFirstSearch(refValue, instances, sortedObjs, outSorted);
-					item.referencedObjects.insert(refValue);
+				if (refValue && dependencyGraph_.find(refValue) != dependencyGraph_.end()) {
+					outReferenced.insert(refValue);
 				}
 				break;
 			}
 			case data_storage::PrimitiveType::Table:
-				depthFirstSearch(&v->asTable(), item, instances, sortedObjs, outSorted);
+				collectReferencedObjects(v->asTable(), outReferenced);
 				break;
 		}
 	}
 }
 
-void SceneAdaptor::depthFirstSearch(SEditorObject object, std::set<SEditorObject> const& instances, std::set<SEditorObject>& sortedObjs, std::vector<DependencyNode>& outSorted) {
-	using namespace raco::core;
+void SceneAdaptor::updateDependencyNode(DependencyNode& node) {
+	std::set<SEditorObject> referenced;
+	collectReferencedObjects(*node.object, referenced);
+	referenced.erase(node.object);
 
-	if (sortedObjs.find(object) != sortedObjs.end()) {
+	if (referenced == node.referencedObjects) {
 		return;
 	}
 
-	DependencyNode item;
-	item.object = object;
-	depthFirstSearch(object.get(), item, instances, sortedObjs, outSorted);
+	std::vector<SEditorObject> removed;
+	std::set_difference(node.referencedObjects.begin(), node.referencedObjects.end(), referenced.begin(), referenced.end(), std::back_inserter(removed));
+	for (const auto& obj : removed) {
+		node.referencedObjects.erase(obj);
+		dependencyGraph_.at(obj).referencingObjects.erase(node.object);
+	}
 
-	outSorted.emplace_back(item);
-	sortedObjs.insert(item.object);
+	for (const auto& obj : referenced) {
+		if (node.referencedObjects.find(obj) == node.referencedObjects.end()) {
+			addDependencyEdge(node, dependencyGraph_.at(obj));
+		}
+	}
 }
 
-void SceneAdaptor::rebuildSortedDependencyGraph(std::set<SEditorObject> const& objects) {
-	dependencyGraph_.clear();
-	dependencyGraph_.reserve(objects.size());
-	std::set<SEditorObject> sortedObjs;
-	for (auto obj : objects) {
-		depthFirstSearch(obj, objects, sortedObjs, dependencyGraph_);
+bool SceneAdaptor::collectReorderRegion(DependencyNode& start, size_t bound, bool forward, const SEditorObject& cycleTarget, std::vector<DependencyNode*>& outNodes) {
+	std::set<SEditorObject> visited{start.object};
+	std::vector<DependencyNode*> stack{&start};
+	while (!stack.empty()) {
+		auto current = stack.back();
+		stack.pop_back();
+		outNodes.emplace_back(current);
+		for (const auto& next : forward ? current->referencingObjects : current->referencedObjects) {
+			if (next == cycleTarget) {
+				return false;
+			}
+			auto& nextNode = dependencyGraph_.at(next);
+			if ((forward ? nextNode.order < bound : nextNode.order > bound) && visited.insert(next).second) {
+				stack.emplace_back(&nextNode);
+			}
+		}
+	}
+	return true;
+}
+
+void SceneAdaptor::addDependencyEdge(DependencyNode& node, DependencyNode& referenced) {
+	node.referencedObjects.insert(referenced.object);
+	referenced.referencingObjects.insert(node.object);
+
+	if (referenced.order < node.order) {
+		return;
+	}
+
+	// The new edge violates the topological order. Reorder only the nodes inside the affected
+	// order range [node.order, referenced.order] (Pearce-Kelly dynamic topological sort):
+	// - the node and everything depending on it inside the range needs to move behind
+	// - the referenced object and everything it depends on inside the range needs to move in front.
+	std::vector<DependencyNode*> dependents;
+	if (!collectReorderRegion(node, referenced.order, true, referenced.object, dependents)) {
+		LOG_WARNING(log_system::RAMSES_ADAPTOR, "Reference cycle between '{}' and '{}' detected; update order is not guaranteed.", node.object->objectName(), referenced.object->objectName());
+		return;
+	}
+	std::vector<DependencyNode*> dependencies;
+	collectReorderRegion(referenced, node.order, false, nullptr, dependencies);
+
+	auto byOrder = [](const DependencyNode* left, const DependencyNode* right) {
+		return left->order < right->order;
+	};
+	std::sort(dependents.begin(), dependents.end(), byOrder);
+	std::sort(dependencies.begin(), dependencies.end(), byOrder);
+
+	std::vector<size_t> orders;
+	orders.reserve(dependents.size() + dependencies.size());
+	for (auto item : dependencies) {
+		orders.emplace_back(item->order);
+	}
+	for (auto item : dependents) {
+		orders.emplace_back(item->order);
+	}
+	std::sort(orders.begin(), orders.end());
+
+	size_t index = 0;
+	for (auto item : dependencies) {
+		item->order = orders[index++];
+	}
+	for (auto item : dependents) {
+		item->order = orders[index++];
 	}
 }
 
@@ -422,17 +578,99 @@ void SceneAdaptor::buildRenderableOrder(ramses::RenderGroup& renderGroup, std::v
 	}
 }
 
+void SceneAdaptor::decodePendingImages() {
+	std::vector<ramses_base::ImageRequest> images;
+	for (const auto& object : dirtyObjects_) {
+		auto it = imageProviders_.find(object);
+		if (it != imageProviders_.end()) {
+			it->second->getPendingImages(images);
+		}
+	}
+	if (images.size() > 1) {
+		// The adaptors pick up the images through decodeImage while syncing, so the ramses resources are still created serially.
+		// The images are held here since the cache may already have evicted them if they exceed its memory budget.
+		auto decoded = ramses_base::TextureDataCache::instance().decodePngs(images);
+		for (size_t index = 0; index < images.size(); index++) {
+			if (decoded[index]) {
+				pendingImages_[{images[index].absPath, images[index].flipVertically}] = decoded[index];
+			}
+		}
+	}
+}
+
+ramses_base::SharedDecodedImage SceneAdaptor::decodeImage(const std::string& absPath, bool flipVertically) {
+	auto it = pendingImages_.find({absPath, flipVertically});
+	if (it != pendingImages_.end()) {
+		return it->second;
+	}
+	return ramses_base::TextureDataCache::instance().decodePng(absPath, flipVertically);
+}
+
 void SceneAdaptor::performBulkEngineUpdate(const std::set<core::SEditorObject>& changedObjects) {
-	if (dependencyGraph_.empty() || !changedObjects.empty()) {
+	for (const auto& object : changedObjects) {
+		auto it = dependencyGraph_.find(object);
+		if (it != dependencyGraph_.end()) {
+			updateDependencyNode(it->second);
+		}
+
+		// The data model may have been changed in ways invalidating the readback snapshots, e.g. by undo.
+		auto outputIt = logicOutputProviders_.find(object);
+		if (outputIt != logicOutputProviders_.end()) {
+			outputIt->second->resetOutputSnapshot();
+		}
+		auto linksIt = linksByObject_.find(object);
+		if (linksIt != linksByObject_.end()) {
+			for (auto link : linksIt->second) {
+				link->resetOutputSnapshot();
+			}
+		}
+	}
+
+	if (renderGroupDirty_) {
 		buildDefaultRenderGroup();
-		rebuildSortedDependencyGraph(std::set<SEditorObject>(project_->instances().begin(), project_->instances().end()));
+		renderGroupDirty_ = false;
 	}
+
+	decodePendingImages();
+
 	std::set<LinkAdaptor*> liftedLinks;
 
 	std::set<SEditorObject> updated;
-	for (const auto& item : dependencyGraph_) {
-		auto object = item.object;
+	std::set<SEditorObject> visited;
+	// Objects are processed in topological order so that referenced objects are synced before the objects referencing them.
+	// Only dirty objects and the objects depending on updated objects are visited.
+	std::map<size_t, SEditorObject> pending;
+	auto schedulePending = [this, &pending, &visited](const SEditorObject& object) {
+		auto it = dependencyGraph_.find(object);
+		if (it != dependencyGraph_.end() && visited.find(object) == visited.end()) {
+			pending.emplace(it->second.order, object);
+		}
+	};
+
+	// Objects tagged dirty again after they have been synced in this update are kept for the next update.
+	std::set<SEditorObject> deferred;
+
+	while (!dirtyObjects_.empty() || !pending.empty()) {
+		for (const auto& object : dirtyObjects_) {
+			if (visited.find(object) != visited.end()) {
+				deferred.insert(object);
+			} else {
+				schedulePending(object);
+			}
+		}
+		dirtyObjects_.clear();
+		if (pending.empty()) {
+			break;
+		}
+
+		auto object = pending.begin()->second;
+		pending.erase(pending.begin());
+		if (!visited.insert(object).second || project_->getInstanceByID(object->objectID()) != object) {
+			continue;
+		}
+
 		if (auto adaptor = lookupAdaptor(object)) {
+			const auto& item = dependencyGraph_.at(object);
 			bool needsUpdate = adaptor->isDirty();
 			if (!needsUpdate) {
 				needsUpdate = std::any_of(item.referencedObjects.begin(), item.referencedObjects.end(),
@@ -442,10 +680,12 @@ void SceneAdaptor::performBulkEngineUpdate(const std::set<core::SEditorObject>&
 			}
 
 			if (needsUpdate) {
-				for (const auto& link : links_) {
-					if (link.first.start.object() == object || link.first.end.object() == object) {
-						liftedLinks.insert(link.second.get());
-						link.second->lift();
+				auto linksIt = linksByObject_.find(object);
+				if (linksIt != linksByObject_.end()) {
+					for (auto link : linksIt->second) {
+						if (liftedLinks.insert(link).second) {
+							link->lift();
+						}
 					}
 				}
 			}
@@ -454,11 +694,18 @@ void SceneAdaptor::performBulkEngineUpdate(const std::set<core::SEditorObject>&
 				auto hasChanged = adaptor->sync(errors_);
 				if (hasChanged) {
 					updated.insert(object);
+					for (const auto& referencing : item.referencingObjects) {
+						schedulePending(referencing);
+					}
 				}
 			}
 		}
 	}
 
+	dirtyObjects_ = std::move(deferred);
+	bulkUpdateVisitedObjects_ = visited.size();
+	pendingImages_.clear();
+
 	for (const auto& link : liftedLinks) {
 		link->connect();
 	}
@@ -466,6 +713,9 @@ void SceneAdaptor::performBulkEngineUpdate(const std::set<core::SEditorObject>&
 	if (!updated.empty()) {
 		deleteUnusedDefaultResources();
 	}
+
+	// Scripts compiled during interface parsing which were not taken by a LuaScriptAdaptor must not stay in the logic engine.
+	logicEngine_->luaScriptCache().releaseCompiledScripts();
 }
 
 }  // namespace raco::ramses_adaptor
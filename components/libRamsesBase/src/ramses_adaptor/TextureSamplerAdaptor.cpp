@@ -12,11 +12,11 @@
 #include <ramses-client-api/MipLevelData.h>
 #include "ramses_adaptor/SceneAdaptor.h"
 #include "ramses_base/RamsesHandles.h"
+#include "ramses_base/TextureDataCache.h"
 #include "user_types/Texture.h"
 #include "user_types/Enumerations.h"
 #include <QDataStream>
 #include <QFile>
-#include "lodepng.h"
 
 namespace raco::ramses_adaptor {
 
@@ -40,23 +40,29 @@ TextureSamplerAdaptor::TextureSamplerAdaptor(SceneAdaptor* sceneAdaptor, std::sh
 			  tagDirty();
 		  }),
 		  sceneAdaptor_->dispatcher()->registerOnPreviewDirty(editorObject, [this]() {
+			  textureStatus_ = true;
 			  tagDirty();
 		  })} {}
 
 bool TextureSamplerAdaptor::sync(core::Errors* errors) {
-	textureData_ = nullptr;
-	std::string uri = editorObject()->uri_.asString();
-	if (!uri.empty()) {
-		// do not clear errors here, this is done earlier in Texture
-		textureData_ = createTexture();
-		if (!textureData_) {
-			LOG_ERROR(raco::log_system::RAMSES_ADAPTOR, "Texture '{}': Couldn't load png file from '{}'", editorObject()->objectName(), uri);
-			errors->addError(core::ErrorCategory::PARSE_ERROR, core::ErrorLevel::ERROR, {editorObject()->shared_from_this(), {"uri"}}, "Image file could not be loaded.");
+	// The sampler needs to be recreated for every change but the decoded texture only for changes of the image.
+	if (textureStatus_ || !textureData_) {
+		reset(nullptr);
+		textureData_ = nullptr;
+		std::string uri = editorObject()->uri_.asString();
+		if (!uri.empty()) {
+			// do not clear errors here, this is done earlier in Texture
+			textureData_ = createTexture();
+			if (!textureData_) {
+				LOG_ERROR(raco::log_system::RAMSES_ADAPTOR, "Texture '{}': Couldn't load png file from '{}'", editorObject()->objectName(), uri);
+				errors->addError(core::ErrorCategory::PARSE_ERROR, core::ErrorLevel::ERROR, {editorObject()->shared_from_this(), {"uri"}}, "Image file could not be loaded.");
+			}
 		}
-	}
 
-	if (!textureData_) {
-		textureData_ = getFallbackTexture();
+		if (!textureData_) {
+			textureData_ = getFallbackTexture();
+		}
+		textureStatus_ = false;
 	}
 
 	if (textureData_) {
@@ -77,34 +83,24 @@ bool TextureSamplerAdaptor::sync(core::Errors* errors) {
 	return true;
 }
 
+void TextureSamplerAdaptor::getPendingImages(std::vector<ramses_base::ImageRequest>& images) {
+	if ((textureStatus_ || !textureData_) && !editorObject()->uri_.asString().empty()) {
+		images.push_back({raco::core::PathQueries::resolveUriPropertyToAbsolutePath(sceneAdaptor_->project(), {editorObject(), {"uri"}}),
+			*editorObject()->origin_ == raco::user_types::TEXTURE_ORIGIN_BOTTOM});
+	}
+}
+
 RamsesTexture2D TextureSamplerAdaptor::createTexture() {
 	std::string pngPath = raco::core::PathQueries::resolveUriPropertyToAbsolutePath(sceneAdaptor_->project(), {editorObject(), {"uri"}});
 
-	unsigned int width = 0;
-	unsigned int height = 0;
-	std::vector<unsigned char> data;
-
-	const unsigned int ret = lodepng::decode(data, width, height, pngPath.c_str());
-	if (ret != 0) {
+	// Flip the image vertically if required to match U/V origin
+	auto image = sceneAdaptor_->decodeImage(pngPath, *editorObject()->origin_ == raco::user_types::TEXTURE_ORIGIN_BOTTOM);
+	if (!image) {
 		return nullptr;
 	}
-	
-	// PNG has top left origin. Flip it vertically if required to match U/V origin
-	if (*editorObject()->origin_ == raco::user_types::TEXTURE_ORIGIN_BOTTOM) { 
-		unsigned lineSize = width * 4;
-		for (unsigned y = 0; y < height/2; y++) {
-			unsigned lineIndex = y * lineSize;
-			unsigned swapIndex = (height - y - 1) * lineSize;
-			for (unsigned x = 0; x < lineSize; x++) {
-				unsigned char tmp = data[lineIndex + x];
-				data[lineIndex + x] = data[swapIndex + x];
-				data[swapIndex + x] = tmp;
-			}
-		}
-	} 
-	
-	ramses::MipLevelData mipLevelData(static_cast<uint32_t>(data.size()), data.data());
-	ramses::Texture2D* textureData = sceneAdaptor_->scene()->createTexture2D(ramses::ETextureFormat::RGBA8, width, height, 1, &mipLevelData, false, {}, ramses::ResourceCacheFlag_DoNotCache, nullptr);
+
+	ramses::MipLevelData mipLevelData(static_cast<uint32_t>(image->data.size()), image->data.data());
+	ramses::Texture2D* textureData = sceneAdaptor_->scene()->createTexture2D(ramses::ETextureFormat::RGBA8, image->width, image->height, 1, &mipLevelData, false, {}, ramses::ResourceCacheFlag_DoNotCache, nullptr);
 
 	return {textureData, createRamsesObjectDeleter<ramses::Texture2D>(sceneAdaptor_->scene())};
 }
@@ -57,4 +57,8 @@ raco::core::EngineInterface* BaseEngineBackend::coreInterface() {
 	return &coreInterface_;
 }
 
+ShaderInterfaceCache& BaseEngineBackend::shaderInterfaceCache() {
+	return shaderInterfaceCache_;
+}
+
 }  // namespace raco::ramses_base
@@ -19,7 +19,11 @@ namespace raco::ramses_base {
 CoreInterfaceImpl::CoreInterfaceImpl(BaseEngineBackend* backend) : backend_{backend} {}
 
 bool CoreInterfaceImpl::parseShader(const std::string& vertexShader, const std::string& geometryShader, const std::string& fragmentShader, const std::string& shaderDefines, raco::core::PropertyInterfaceList& outUniforms, raco::core::PropertyInterfaceList& outAttributes, std::string& outError) {
-	return raco::ramses_base::parseShaderText(backend_->internalScene(), vertexShader, geometryShader, fragmentShader, shaderDefines, outUniforms, outAttributes, outError);
+	const auto& shaderInterface = backend_->shaderInterfaceCache().parse(backend_->internalScene(), vertexShader, geometryShader, fragmentShader, shaderDefines);
+	outUniforms = shaderInterface.uniforms;
+	outAttributes = shaderInterface.attributes;
+	outError = shaderInterface.error;
+	return shaderInterface.success;
 }
 
 bool CoreInterfaceImpl::parseLuaScript(const std::string& luaScript, raco::core::PropertyInterfaceList& outInputs, raco::core::PropertyInterfaceList& outOutputs, std::string& outError) {
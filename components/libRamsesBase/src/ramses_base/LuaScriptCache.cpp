@@ -0,0 +1,121 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "ramses_base/LuaScriptCache.h"
+
+#include "log_system/log.h"
+
+#include <map>
+
+namespace raco::ramses_base {
+
+namespace {
+void fillLuaScriptInterface(std::vector<raco::core::PropertyInterface> &interface, const rlogic::Property *property) {
+	static const std::map<rlogic::EPropertyType, raco::core::EnginePrimitive> typeMap = {
+		{rlogic::EPropertyType::Float, raco::core::EnginePrimitive::Double},
+		{rlogic::EPropertyType::Vec2f, raco::core::EnginePrimitive::Vec2f},
+		{rlogic::EPropertyType::Vec3f, raco::core::EnginePrimitive::Vec3f},
+		{rlogic::EPropertyType::Vec4f, raco::core::EnginePrimitive::Vec4f},
+		{rlogic::EPropertyType::Int32, raco::core::EnginePrimitive::Int32},
+		{rlogic::EPropertyType::Vec2i, raco::core::EnginePrimitive::Vec2i},
+		{rlogic::EPropertyType::Vec3i, raco::core::EnginePrimitive::Vec3i},
+		{rlogic::EPropertyType::Vec4i, raco::core::EnginePrimitive::Vec4i},
+		{rlogic::EPropertyType::String, raco::core::EnginePrimitive::String},
+		{rlogic::EPropertyType::Bool, raco::core::EnginePrimitive::Bool},
+		{rlogic::EPropertyType::Struct, raco::core::EnginePrimitive::Struct},
+		{rlogic::EPropertyType::Array, raco::core::EnginePrimitive::Array}};
+	interface.reserve(property->getChildCount());
+	for (int i{0}; i < property->getChildCount(); i++) {
+		auto child{property->getChild(i)};
+		if (typeMap.find(child->getType()) != typeMap.end()) {
+			// has children
+			auto &it = interface.emplace_back(std::string{child->getName()}, typeMap.at(child->getType()));
+			if (child->getChildCount() > 0) {
+				fillLuaScriptInterface(it.children, child);
+			}
+		}
+	}
+}
+}  // namespace
+
+LuaScriptCache::LuaScriptCache(rlogic::LogicEngine& engine) : engine_{engine} {
+}
+
+LuaScriptCache::~LuaScriptCache() {
+	releaseCompiledScripts();
+}
+
+const LuaScriptCache::ScriptInterface& LuaScriptCache::parse(const std::string& source) {
+	auto hash = std::hash<std::string>{}(source);
+	auto it = entries_.find(hash);
+	if (it != entries_.end() && it->second.source == source) {
+		hitCount_++;
+		LOG_TRACE(log_system::RAMSES_BACKEND, "Lua script cache hit: {}", hash);
+		return it->second.scriptInterface;
+	}
+
+	if (it == entries_.end() && entries_.size() >= maxEntries) {
+		releaseCompiledScripts();
+		entries_.clear();
+	}
+
+	auto& entry = entries_[hash];
+	if (entry.compiledScript) {
+		// Hash collision with a different source: drop the script compiled for the other source.
+		engine_.destroy(*entry.compiledScript);
+		pendingScripts_--;
+	}
+	entry = Entry{source, {}, nullptr};
+
+	compileCount_++;
+	auto script = engine_.createLuaScriptFromSource(source, "Stage::PreprocessScript");
+	if (script) {
+		if (auto inputs = script->getInputs()) {
+			fillLuaScriptInterface(entry.scriptInterface.inputs, inputs);
+		}
+		if (auto outputs = script->getOutputs()) {
+			fillLuaScriptInterface(entry.scriptInterface.outputs, outputs);
+		}
+		entry.scriptInterface.success = true;
+		entry.compiledScript = script;
+		pendingScripts_++;
+	} else {
+		entry.scriptInterface.error = engine_.getErrors().at(0).message;
+	}
+	return entry.scriptInterface;
+}
+
+rlogic::LuaScript* LuaScriptCache::takeCompiledScript(const std::string& source) {
+	if (pendingScripts_ == 0) {
+		return nullptr;
+	}
+	auto it = entries_.find(std::hash<std::string>{}(source));
+	if (it == entries_.end() || it->second.source != source || !it->second.compiledScript) {
+		return nullptr;
+	}
+	auto script = it->second.compiledScript;
+	it->second.compiledScript = nullptr;
+	pendingScripts_--;
+	return script;
+}
+
+void LuaScriptCache::releaseCompiledScripts() {
+	if (pendingScripts_ == 0) {
+		return;
+	}
+	for (auto& [hash, entry] : entries_) {
+		if (entry.compiledScript) {
+			engine_.destroy(*entry.compiledScript);
+			entry.compiledScript = nullptr;
+		}
+	}
+	pendingScripts_ = 0;
+}
+
+}  // namespace raco::ramses_base
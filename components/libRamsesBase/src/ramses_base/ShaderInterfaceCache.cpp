@@ -0,0 +1,213 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "ramses_base/ShaderInterfaceCache.h"
+
+#include "log_system/log.h"
+#include "ramses_base/Utils.h"
+#include "utils/stdfilesystem.h"
+
+#include <QCryptographicHash>
+#include <QSaveFile>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace raco::ramses_base {
+
+namespace {
+
+constexpr char cacheFileMagic[8] = {'R', 'A', 'C', 'O', 'S', 'H', 'D', 'C'};
+constexpr uint32_t cacheFileVersion = 2;
+
+void addToHash(QCryptographicHash& hash, const std::string& text) {
+	uint64_t size = text.size();
+	hash.addData(reinterpret_cast<const char*>(&size), sizeof(size));
+	hash.addData(text.data(), static_cast<int>(text.size()));
+}
+
+template <typename T>
+void write(std::ostream& stream, T value) {
+	stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void write(std::ostream& stream, const std::string& text) {
+	write<uint32_t>(stream, static_cast<uint32_t>(text.size()));
+	stream.write(text.data(), text.size());
+}
+
+void write(std::ostream& stream, const core::PropertyInterfaceList& list) {
+	write<uint32_t>(stream, static_cast<uint32_t>(list.size()));
+	for (const auto& property : list) {
+		write(stream, property.name);
+		write<int32_t>(stream, static_cast<int32_t>(property.type));
+		write(stream, property.children);
+	}
+}
+
+template <typename T>
+bool read(std::istream& stream, T& value) {
+	return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+bool read(std::istream& stream, std::string& text) {
+	uint32_t size;
+	if (!read(stream, size)) {
+		return false;
+	}
+	text.resize(size);
+	return static_cast<bool>(stream.read(text.data(), size));
+}
+
+bool read(std::istream& stream, core::PropertyInterfaceList& list) {
+	uint32_t size;
+	if (!read(stream, size)) {
+		return false;
+	}
+	for (uint32_t i = 0; i < size; i++) {
+		std::string name;
+		int32_t type;
+		if (!read(stream, name) || !read(stream, type)) {
+			return false;
+		}
+		auto& property = list.emplace_back(name, static_cast<core::EnginePrimitive>(type));
+		if (!read(stream, property.children)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+}  // namespace
+
+ShaderInterfaceCache::~ShaderInterfaceCache() {
+	if (!cacheFilePath_.empty()) {
+		LOG_INFO(log_system::RAMSES_BACKEND, "Shader interface cache: {} hits, {} misses, {} entries", hitCount_, missCount_, entries_.size());
+		save();
+	}
+}
+
+std::string ShaderInterfaceCache::computeDigest(const std::string& vertexShader, const std::string& geometryShader, const std::string& fragmentShader, const std::string& shaderDefines) {
+	QCryptographicHash hash(QCryptographicHash::Sha256);
+	addToHash(hash, vertexShader);
+	addToHash(hash, geometryShader);
+	addToHash(hash, fragmentShader);
+	addToHash(hash, shaderDefines);
+	return hash.result().toStdString();
+}
+
+const ShaderInterfaceCache::ShaderInterface& ShaderInterfaceCache::parse(ramses::Scene& scene, const std::string& vertexShader, const std::string& geometryShader, const std::string& fragmentShader, const std::string& shaderDefines) {
+	auto key = computeDigest(vertexShader, geometryShader, fragmentShader, shaderDefines);
+	auto it = entries_.find(key);
+	if (it != entries_.end()) {
+		hitCount_++;
+		it->second.used = true;
+		LOG_TRACE(log_system::RAMSES_BACKEND, "Shader interface cache hit ({} hits, {} misses)", hitCount_, missCount_);
+		return it->second.shaderInterface;
+	}
+
+	missCount_++;
+	LOG_TRACE(log_system::RAMSES_BACKEND, "Shader interface cache miss ({} hits, {} misses)", hitCount_, missCount_);
+	auto& entry = entries_[key];
+	entry.used = true;
+	auto& shaderInterface = entry.shaderInterface;
+	shaderInterface.success = parseShaderText(scene, vertexShader, geometryShader, fragmentShader, shaderDefines, shaderInterface.uniforms, shaderInterface.attributes, shaderInterface.error);
+	modified_ = true;
+	return shaderInterface;
+}
+
+void ShaderInterfaceCache::setCacheFile(const std::string& cacheFilePath) {
+	cacheFilePath_ = cacheFilePath;
+	if (load()) {
+		LOG_INFO(log_system::RAMSES_BACKEND, "Loaded {} entries from shader interface cache {}", entries_.size(), cacheFilePath_);
+	}
+}
+
+bool ShaderInterfaceCache::load() {
+	std::ifstream stream(cacheFilePath_, std::ios::binary);
+	if (!stream) {
+		return false;
+	}
+
+	char magic[sizeof(cacheFileMagic)];
+	uint32_t version;
+	std::string ramsesVersion;
+	uint64_t count;
+	if (!stream.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), cacheFileMagic) ||
+		!read(stream, version) || version != cacheFileVersion ||
+		!read(stream, ramsesVersion) || ramsesVersion != getRamsesVersionString() ||
+		!read(stream, count)) {
+		LOG_INFO(log_system::RAMSES_BACKEND, "Discarding outdated shader interface cache {}", cacheFilePath_);
+		return false;
+	}
+
+	std::unordered_map<std::string, Entry> entries;
+	for (uint64_t i = 0; i < count; i++) {
+		std::string key;
+		uint8_t success;
+		Entry entry;
+		if (!read(stream, key) || !read(stream, success) || !read(stream, entry.shaderInterface.error) ||
+			!read(stream, entry.shaderInterface.uniforms) || !read(stream, entry.shaderInterface.attributes)) {
+			LOG_WARNING(log_system::RAMSES_BACKEND, "Discarding corrupt shader interface cache {}", cacheFilePath_);
+			return false;
+		}
+		entry.shaderInterface.success = success != 0;
+		entries[key] = std::move(entry);
+	}
+
+	// Entries parsed in this session take precedence.
+	entries_.merge(entries);
+	return true;
+}
+
+bool ShaderInterfaceCache::save() const {
+	if (cacheFilePath_.empty() || !modified_) {
+		return true;
+	}
+
+	std::error_code ec;
+	std::filesystem::create_directories(std::filesystem::path(cacheFilePath_).parent_path(), ec);
+
+	std::ostringstream stream(std::ios::binary);
+	bool prune = entries_.size() > maxEntries;
+	uint64_t count = 0;
+	for (const auto& [key, entry] : entries_) {
+		if (!prune || entry.used) {
+			count++;
+		}
+	}
+
+	stream.write(cacheFileMagic, sizeof(cacheFileMagic));
+	write(stream, cacheFileVersion);
+	write(stream, getRamsesVersionString());
+	write(stream, count);
+	for (const auto& [key, entry] : entries_) {
+		if (!prune || entry.used) {
+			write(stream, key);
+			write<uint8_t>(stream, entry.shaderInterface.success ? 1 : 0);
+			write(stream, entry.shaderInterface.error);
+			write(stream, entry.shaderInterface.uniforms);
+			write(stream, entry.shaderInterface.attributes);
+		}
+	}
+
+	// QSaveFile writes to a uniquely named temporary file and atomically replaces the cache file on commit,
+	// so concurrently running instances never see or produce partially written caches.
+	auto data = stream.str();
+	QSaveFile file(QString::fromStdString(cacheFilePath_));
+	if (!file.open(QIODevice::WriteOnly) || file.write(data.data(), static_cast<qint64>(data.size())) != static_cast<qint64>(data.size()) || !file.commit()) {
+		LOG_WARNING(log_system::RAMSES_BACKEND, "Can't write shader interface cache {}: {}", cacheFilePath_, file.errorString().toStdString());
+		return false;
+	}
+	modified_ = false;
+	return true;
+}
+
+}  // namespace raco::ramses_base
@@ -0,0 +1,317 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "ramses_base/TextureDataCache.h"
+
+#include "log_system/log.h"
+#include "utils/stdfilesystem.h"
+
+#include "lodepng.h"
+
+#include <algorithm>
+
+namespace raco::ramses_base {
+
+namespace {
+
+int64_t modificationTime(const std::string& absPath) {
+	std::error_code ec;
+	auto time = std::filesystem::last_write_time(absPath, ec);
+	if (ec) {
+		return 0;
+	}
+	return static_cast<int64_t>(time.time_since_epoch().count());
+}
+
+void flipRows(DecodedImage& image) {
+	const size_t lineSize = static_cast<size_t>(image.width) * 4;
+	for (unsigned y = 0; y < image.height / 2; y++) {
+		auto line = image.data.begin() + y * lineSize;
+		auto swapLine = image.data.begin() + (image.height - y - 1) * lineSize;
+		std::swap_ranges(line, line + lineSize, swapLine);
+	}
+}
+
+}  // namespace
+
+TextureDataCache& TextureDataCache::instance() {
+	static TextureDataCache cache;
+	return cache;
+}
+
+TextureDataCache::~TextureDataCache() {
+	{
+		std::lock_guard<std::mutex> lock(queueMutex_);
+		stopWorkers_ = true;
+	}
+	queueCondition_.notify_all();
+	for (auto& worker : workers_) {
+		worker.join();
+	}
+
+	// The monitor may already be gone at process exit, so don't unregister through it.
+	for (auto& [path, listener] : listeners_) {
+		static_cast<void>(listener.release());
+	}
+}
+
+SharedDecodedImage TextureDataCache::decodePng(const std::string& absPath, bool flipVertically) {
+	Key key{absPath, modificationTime(absPath), flipVertically};
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		updateListeners();
+		auto it = index_.find(key);
+		if (it != index_.end()) {
+			entries_.splice(entries_.begin(), entries_, it->second);
+			++hitCount_;
+			return it->second->image;
+		}
+		++missCount_;
+	}
+
+	// Decode without holding the lock so that different images can be decoded in parallel.
+	auto image = decode(absPath, flipVertically);
+	if (!image) {
+		return nullptr;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	insert(key, image);
+	updateListeners();
+	return image;
+}
+
+std::vector<SharedDecodedImage> TextureDataCache::decodePngs(const std::vector<ImageRequest>& requests) {
+	std::vector<SharedDecodedImage> images(requests.size());
+	std::vector<Key> keys;
+	std::vector<size_t> missing;
+	// Pairs of request index and index of the identical request which is decoded.
+	std::vector<std::pair<size_t, size_t>> duplicates;
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		std::map<Key, size_t> scheduled;
+		for (size_t index = 0; index < requests.size(); index++) {
+			keys.emplace_back(requests[index].absPath, modificationTime(requests[index].absPath), requests[index].flipVertically);
+			auto it = index_.find(keys.back());
+			if (it != index_.end()) {
+				entries_.splice(entries_.begin(), entries_, it->second);
+				images[index] = it->second->image;
+				++hitCount_;
+			} else if (scheduled.emplace(keys.back(), index).second) {
+				missing.emplace_back(index);
+				++missCount_;
+			} else {
+				duplicates.emplace_back(index, scheduled[keys.back()]);
+			}
+		}
+	}
+
+	if (!missing.empty()) {
+		// The tasks refer to the local variables, so this function must not return before all of them are done.
+		std::mutex doneMutex;
+		std::condition_variable doneCondition;
+		size_t remaining = missing.size();
+		{
+			std::lock_guard<std::mutex> lock(queueMutex_);
+			if (workers_.empty()) {
+				// The calling thread also decodes, so one thread less than the hardware supports is enough.
+				auto numWorkers = std::max(2u, std::thread::hardware_concurrency()) - 1;
+				for (unsigned i = 0; i < numWorkers; i++) {
+					workers_.emplace_back([this]() { runWorker(); });
+				}
+			}
+			for (auto index : missing) {
+				queue_.emplace_back([this, index, &requests, &images, &keys, &doneMutex, &doneCondition, &remaining]() {
+					images[index] = decode(requests[index].absPath, requests[index].flipVertically);
+					if (images[index]) {
+						std::lock_guard<std::mutex> lock(mutex_);
+						insert(keys[index], images[index]);
+					}
+					std::lock_guard<std::mutex> lock(doneMutex);
+					if (--remaining == 0) {
+						doneCondition.notify_all();
+					}
+				});
+			}
+		}
+		queueCondition_.notify_all();
+
+		while (auto task = popTask()) {
+			task();
+		}
+		std::unique_lock<std::mutex> lock(doneMutex);
+		doneCondition.wait(lock, [&remaining]() { return remaining == 0; });
+		LOG_DEBUG(log_system::RAMSES_BACKEND, "Decoded {} images", missing.size());
+	}
+
+	for (const auto& [index, decodedIndex] : duplicates) {
+		images[index] = images[decodedIndex];
+	}
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	updateListeners();
+	return images;
+}
+
+void TextureDataCache::runWorker() {
+	while (true) {
+		std::function<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(queueMutex_);
+			queueCondition_.wait(lock, [this]() { return stopWorkers_ || !queue_.empty(); });
+			if (stopWorkers_) {
+				return;
+			}
+			task = std::move(queue_.front());
+			queue_.pop_front();
+		}
+		task();
+	}
+}
+
+std::function<void()> TextureDataCache::popTask() {
+	std::lock_guard<std::mutex> lock(queueMutex_);
+	if (queue_.empty()) {
+		return {};
+	}
+	auto task = std::move(queue_.front());
+	queue_.pop_front();
+	return task;
+}
+
+SharedDecodedImage TextureDataCache::decode(const std::string& absPath, bool flipVertically) {
+	auto image = std::make_shared<DecodedImage>();
+	if (lodepng::decode(image->data, image->width, image->height, absPath) != 0) {
+		return nullptr;
+	}
+	// PNG has top left origin.
+	if (flipVertically) {
+		flipRows(*image);
+	}
+	return image;
+}
+
+void TextureDataCache::insert(const Key& key, SharedDecodedImage image) {
+	auto it = index_.find(key);
+	if (it != index_.end()) {
+		// Decoded concurrently by another thread: keep the existing entry.
+		return;
+	}
+	if (image->data.size() > memoryBudget_) {
+		return;
+	}
+	evict(memoryBudget_ - image->data.size());
+	bytesHeld_ += image->data.size();
+	entries_.push_front({key, std::move(image)});
+	index_[key] = entries_.begin();
+	unwatchedPaths_.insert(std::get<0>(key));
+}
+
+void TextureDataCache::evict(size_t budget) {
+	while (bytesHeld_ > budget && !entries_.empty()) {
+		const auto& entry = entries_.back();
+		LOG_TRACE(log_system::RAMSES_BACKEND, "Evicting decoded image '{}' from texture cache", std::get<0>(entry.key));
+		bytesHeld_ -= entry.image->data.size();
+		index_.erase(entry.key);
+		entries_.pop_back();
+	}
+}
+
+void TextureDataCache::invalidate(const std::string& absPath) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	for (auto it = entries_.begin(); it != entries_.end();) {
+		if (std::get<0>(it->key) == absPath) {
+			bytesHeld_ -= it->image->data.size();
+			index_.erase(it->key);
+			it = entries_.erase(it);
+		} else {
+			++it;
+		}
+	}
+	// The listener is not removed here since this may be called from its own callback; see updateListeners.
+}
+
+void TextureDataCache::clear() {
+	std::lock_guard<std::mutex> lock(mutex_);
+	entries_.clear();
+	index_.clear();
+	bytesHeld_ = 0;
+	updateListeners();
+}
+
+void TextureDataCache::setFileChangeMonitor(core::FileChangeMonitor* monitor) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	listeners_.clear();
+	fileChangeMonitor_ = monitor;
+	monitorThread_ = std::this_thread::get_id();
+	unwatchedPaths_.clear();
+	for (const auto& entry : entries_) {
+		unwatchedPaths_.insert(std::get<0>(entry.key));
+	}
+	updateListeners();
+}
+
+void TextureDataCache::updateListeners() {
+	if (!fileChangeMonitor_ || std::this_thread::get_id() != monitorThread_) {
+		return;
+	}
+
+	std::set<std::string> cachedPaths;
+	for (const auto& entry : entries_) {
+		cachedPaths.insert(std::get<0>(entry.key));
+	}
+	for (auto it = listeners_.begin(); it != listeners_.end();) {
+		if (cachedPaths.find(it->first) == cachedPaths.end()) {
+			it = listeners_.erase(it);
+		} else {
+			++it;
+		}
+	}
+	for (const auto& path : unwatchedPaths_) {
+		if (cachedPaths.find(path) != cachedPaths.end() && listeners_.find(path) == listeners_.end()) {
+			listeners_[path] = fileChangeMonitor_->registerFileChangedHandler(path, {nullptr, nullptr, [this, path]() {
+																					  invalidate(path);
+																				  }});
+		}
+	}
+	unwatchedPaths_.clear();
+}
+
+void TextureDataCache::setMemoryBudget(size_t bytes) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	memoryBudget_ = bytes;
+	evict(memoryBudget_);
+}
+
+size_t TextureDataCache::memoryBudget() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return memoryBudget_;
+}
+
+size_t TextureDataCache::bytesHeld() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return bytesHeld_;
+}
+
+size_t TextureDataCache::entryCount() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return entries_.size();
+}
+
+size_t TextureDataCache::hitCount() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return hitCount_;
+}
+
+size_t TextureDataCache::missCount() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return missCount_;
+}
+
+}  // namespace raco::ramses_base
@@ -122,48 +122,14 @@ bool parseShaderText(ramses::Scene &scene, const std::string &vertexShader, cons
 	return success;
 }
 
-namespace {
-void fillLuaScriptInterface(std::vector<raco::core::PropertyInterface> &interface, const rlogic::Property *property) {
-	static const std::map<rlogic::EPropertyType, raco::core::EnginePrimitive> typeMap = {
-		{rlogic::EPropertyType::Float, raco::core::EnginePrimitive::Double},
-		{rlogic::EPropertyType::Vec2f, raco::core::EnginePrimitive::Vec2f},
-		{rlogic::EPropertyType::Vec3f, raco::core::EnginePrimitive::Vec3f},
-		{rlogic::EPropertyType::Vec4f, raco::core::EnginePrimitive::Vec4f},
-		{rlogic::EPropertyType::Int32, raco::core::EnginePrimitive::Int32},
-		{rlogic::EPropertyType::Vec2i, raco::core::EnginePrimitive::Vec2i},
-		{rlogic::EPropertyType::Vec3i, raco::core::EnginePrimitive::Vec3i},
-		{rlogic::EPropertyType::Vec4i, raco::core::EnginePrimitive::Vec4i},
-		{rlogic::EPropertyType::String, raco::core::EnginePrimitive::String},
-		{rlogic::EPropertyType::Bool, raco::core::EnginePrimitive::Bool},
-		{rlogic::EPropertyType::Struct, raco::core::EnginePrimitive::Struct},
-		{rlogic::EPropertyType::Array, raco::core::EnginePrimitive::Array}};
-	interface.reserve(property->getChildCount());
-	for (int i{0}; i < property->getChildCount(); i++) {
-		auto child{property->getChild(i)};
-		if (typeMap.find(child->getType()) != typeMap.end()) {
-			// has children
-			auto &it = interface.emplace_back(std::string{child->getName()}, typeMap.at(child->getType()));
-			if (child->getChildCount() > 0) {
-				fillLuaScriptInterface(it.children, child);
-			}
-		}
-	}
-}
-}  // namespace
-
 bool parseLuaScript(LogicEngine &engine, const std::string &luaScript, raco::core::PropertyInterfaceList &outInputs, raco::core::PropertyInterfaceList &outOutputs, std::string &outError) {
-	auto script = engine.createLuaScriptFromSource(luaScript, "Stage::PreprocessScript");
-	if (script) {
-		if (auto inputs = script->getInputs()) {
-			fillLuaScriptInterface(outInputs, inputs);
-		}
-		if (auto outputs = script->getOutputs()) {
-			fillLuaScriptInterface(outOutputs, outputs);
-		}
-		engine.destroy(*script);
+	const auto &scriptInterface = engine.luaScriptCache().parse(luaScript);
+	if (scriptInterface.success) {
+		outInputs = scriptInterface.inputs;
+		outOutputs = scriptInterface.outputs;
 		return true;
 	} else {
-		outError = engine.getErrors().at(0).message;
+		outError = scriptInterface.error;
 		return false;
 	}
 }
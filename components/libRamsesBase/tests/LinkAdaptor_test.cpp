@@ -208,3 +208,41 @@ end
 	ASSERT_NO_FATAL_FAILURE(dispatch());
 	ASSERT_TRUE(backend.logicEngine().update());
 }
+
+TEST_F(LinkAdaptorFixture, linkRemovalKeepsOtherLinksOfSameObject) {
+	const auto luaScript{context.createObject(raco::user_types::LuaScript::typeDescription.typeName, "lua_script", "lua_script_id")};
+	const auto node1{context.createObject(raco::user_types::Node::typeDescription.typeName, "node1", "node1_id")};
+	const auto node2{context.createObject(raco::user_types::Node::typeDescription.typeName, "node2", "node2_id")};
+	raco::utils::file::write((cwd_path() / "lua_script.lua").string(), R"(
+function interface()
+	IN.x = FLOAT
+	OUT.translation = VEC3F
+end
+function run()
+    OUT.translation = { IN.x, 0.0, 0.0 }
+end
+	)");
+	context.set({luaScript, {"uri"}}, (cwd_path() / "lua_script.lua").string());
+	auto link1 = context.addLink({luaScript, {"luaOutputs", "translation"}}, {node1, {"translation"}});
+	auto link2 = context.addLink({luaScript, {"luaOutputs", "translation"}}, {node2, {"translation"}});
+	ASSERT_NO_FATAL_FAILURE(dispatch());
+
+	context.removeLink(link1->endProp());
+	context.set({luaScript, {"luaInputs", "x"}}, 5.0);
+	ASSERT_NO_FATAL_FAILURE(dispatch());
+
+	float x, y, z;
+	select<ramses::Node>(*sceneContext.scene(), "node1")->getTranslation(x, y, z);
+	EXPECT_EQ(0.0f, x);
+	select<ramses::Node>(*sceneContext.scene(), "node2")->getTranslation(x, y, z);
+	EXPECT_EQ(5.0f, x);
+
+	// Recreating the script engine objects must reconnect the remaining link.
+	context.set({luaScript, {"uri"}}, std::string());
+	context.set({luaScript, {"uri"}}, (cwd_path() / "lua_script.lua").string());
+	context.set({luaScript, {"luaInputs", "x"}}, 7.0);
+	ASSERT_NO_FATAL_FAILURE(dispatch());
+
+	select<ramses::Node>(*sceneContext.scene(), "node2")->getTranslation(x, y, z);
+	EXPECT_EQ(7.0f, x);
+}
@@ -629,3 +629,77 @@ end
 	engineObj = select<rlogic::LuaScript>(sceneContext.logicEngine(), "PrefabInstance.LuaScript Name");
 	ASSERT_TRUE(engineObj == nullptr);
 }
+
+TEST_F(LuaScriptAdaptorFixture, readback_only_writes_changed_outputs) {
+	auto luaScript = create<LuaScript>("LuaScript Name");
+
+	std::string uriPath{(cwd_path() / "script.lua").string()};
+	raco::utils::file::write(uriPath, R"(
+function interface()
+	IN.value = INT
+	OUT.value = INT
+	OUT.vector = VEC3F
+end
+
+function run()
+	OUT.value = IN.value
+	OUT.vector = { 1.0, 2.0, 3.0 }
+end
+)");
+	context.set({luaScript, {"uri"}}, uriPath);
+	context.set({luaScript, {"luaInputs", "value"}}, 5);
+	dispatch();
+
+	sceneContext.readDataFromEngine(recorder);
+	EXPECT_EQ(sceneContext.readbackStatistics().propertiesRead, 2);
+	EXPECT_EQ(sceneContext.readbackStatistics().propertiesWritten, 2);
+	EXPECT_EQ(core::ValueHandle(luaScript, {"luaOutputs", "value"}).asInt(), 5);
+	EXPECT_EQ(core::ValueHandle(luaScript, {"luaOutputs", "vector", "y"}).asDouble(), 2.0);
+
+	sceneContext.readDataFromEngine(recorder);
+	EXPECT_EQ(sceneContext.readbackStatistics().propertiesRead, 2);
+	EXPECT_EQ(sceneContext.readbackStatistics().propertiesWritten, 0);
+
+	context.set({luaScript, {"luaInputs", "value"}}, 7);
+	dispatch();
+
+	sceneContext.readDataFromEngine(recorder);
+	EXPECT_EQ(sceneContext.readbackStatistics().propertiesWritten, 1);
+	EXPECT_EQ(core::ValueHandle(luaScript, {"luaOutputs", "value"}).asInt(), 7);
+}
+
+TEST_F(LuaScriptAdaptorFixture, script_compiled_once_for_interface_and_engine) {
+	auto& cache = backend.logicEngine().luaScriptCache();
+	auto compileCount = cache.compileCount();
+	auto hitCount = cache.hitCount();
+
+	std::string uriPath{(cwd_path() / "script.lua").string()};
+	raco::utils::file::write(uriPath, R"(
+function interface()
+	IN.value = FLOAT
+	OUT.value = FLOAT
+end
+
+function run()
+	OUT.value = IN.value
+end
+)");
+	auto luaScript = create<LuaScript>("LuaScript Name");
+	context.set({luaScript, {"uri"}}, uriPath);
+	dispatch();
+
+	EXPECT_EQ(cache.compileCount(), compileCount + 1);
+	EXPECT_EQ(backend.logicEngine().scripts().size(), 1);
+	auto engineObj{select<rlogic::LuaScript>(sceneContext.logicEngine(), "LuaScript Name")};
+	ASSERT_NE(engineObj, nullptr);
+	EXPECT_NE(engineObj->getInputs()->getChild("value"), nullptr);
+
+	auto otherScript = create<LuaScript>("Other Script");
+	context.set({otherScript, {"uri"}}, uriPath);
+	dispatch();
+
+	EXPECT_EQ(cache.compileCount(), compileCount + 1);
+	EXPECT_EQ(cache.hitCount(), hitCount + 1);
+	EXPECT_EQ(backend.logicEngine().scripts().size(), 2);
+	EXPECT_NE(select<rlogic::LuaScript>(sceneContext.logicEngine(), "Other Script"), nullptr);
+}
@@ -38,3 +38,34 @@ TEST_F(MaterialAdaptorTest, context_scene_effect_name_change) {
 	EXPECT_EQ(appearances.size(), 1);
 	ASSERT_TRUE(isRamsesNameInArray("Changed_Appearance", appearances));
 }
+
+TEST_F(MaterialAdaptorTest, uniform_sweep_does_not_recreate_effect) {
+	auto material = create_material("Material", "shaders/basic.vert", "shaders/basic.frag");
+	dispatch();
+
+	auto adaptor = sceneContext.lookup<raco::ramses_adaptor::MaterialAdaptor>(material);
+	ASSERT_NE(adaptor, nullptr);
+	ASSERT_TRUE(adaptor->isValid());
+	EXPECT_EQ(adaptor->effectCreationCount(), 1);
+	auto appearance = adaptor->appearance();
+
+	for (int i = 0; i < 10; i++) {
+		context.set({material, {"uniforms", "u_color", "x"}}, 0.1 * i);
+		context.set({material, {"options", "depthwrite"}}, i % 2 == 0);
+		dispatch();
+	}
+
+	EXPECT_EQ(adaptor->effectCreationCount(), 1);
+	EXPECT_EQ(adaptor->appearance(), appearance);
+
+	ramses::UniformInput input;
+	(*appearance)->getEffect().findUniformInput("u_color", input);
+	float x, y, z;
+	(*appearance)->getInputValueVector3f(input, x, y, z);
+	EXPECT_FLOAT_EQ(x, 0.9f);
+
+	context.set({material, {"uriVertex"}}, (cwd_path() / "shaders/color.vert").string());
+	context.set({material, {"uriFragment"}}, (cwd_path() / "shaders/color.frag").string());
+	dispatch();
+	EXPECT_EQ(adaptor->effectCreationCount(), 2);
+}
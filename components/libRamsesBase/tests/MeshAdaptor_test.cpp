@@ -14,6 +14,58 @@
 
 class MeshAdaptorTest : public RamsesBaseFixture<> {};
 
+namespace {
+
+// Mesh without attributes that only provides a vertex count and a single triangle addressing the last vertex.
+class IndexOnlyMesh : public raco::core::MeshData {
+public:
+	explicit IndexOnlyMesh(uint32_t numVertices) : numVertices_(numVertices), indices_(std::vector<uint32_t>{0, numVertices / 2, numVertices - 1}) {}
+
+	uint32_t numSubmeshes() const override {
+		return 1;
+	}
+	uint32_t numTriangles() const override {
+		return 1;
+	}
+	uint32_t numVertices() const override {
+		return numVertices_;
+	}
+	std::vector<std::string> getMaterialNames() const override {
+		return {};
+	}
+	raco::core::SharedBuffer<uint32_t> getIndices() const override {
+		return indices_;
+	}
+	const std::vector<IndexBufferRangeInfo>& submeshIndexBufferRanges() const override {
+		return ranges_;
+	}
+	uint32_t numAttributes() const override {
+		return 0;
+	}
+	std::string attribName(int) const override {
+		return {};
+	}
+	uint32_t attribDataSize(int) const override {
+		return 0;
+	}
+	uint32_t attribElementCount(int) const override {
+		return 0;
+	}
+	VertexAttribDataType attribDataType(int) const override {
+		return VertexAttribDataType::VAT_Float;
+	}
+	const char* attribBuffer(int) const override {
+		return nullptr;
+	}
+
+private:
+	uint32_t numVertices_;
+	raco::core::SharedBuffer<uint32_t> indices_;
+	std::vector<IndexBufferRangeInfo> ranges_{{0, 3}};
+};
+
+}  // namespace
+
 
 TEST_F(MeshAdaptorTest, context_mesh_name_change) {
 	auto node = context.createObject(raco::user_types::Mesh::typeDescription.typeName, "Mesh Name");
@@ -38,3 +90,46 @@ TEST_F(MeshAdaptorTest, context_mesh_name_change) {
 	ASSERT_TRUE(isRamsesNameInArray("Changed_MeshVertexData_a_Normal", meshStuff));
 	ASSERT_TRUE(isRamsesNameInArray("Changed_MeshVertexData_a_TextureCoordinate", meshStuff));
 }
+
+TEST_F(MeshAdaptorTest, context_mesh_name_change_keeps_resources) {
+	auto node = context.createObject(raco::user_types::Mesh::typeDescription.typeName, "Mesh Name");
+	context.set({node, {"uri"}}, cwd_path().append("meshes/Duck.glb").string());
+	dispatch();
+
+	auto adaptor = sceneContext.lookup<raco::ramses_adaptor::MeshAdaptor>(node);
+	auto indices = adaptor->indicesPtr();
+	auto positions = adaptor->vertexData().at("a_Position");
+
+	context.set({node, {"objectName"}}, std::string("Changed"));
+	dispatch();
+
+	EXPECT_EQ(adaptor->indicesPtr(), indices);
+	EXPECT_EQ(adaptor->vertexData().at("a_Position"), positions);
+	EXPECT_EQ(std::string(indices->getName()), "Changed_MeshIndexData");
+}
+
+TEST_F(MeshAdaptorTest, small_mesh_uses_16_bit_indices) {
+	auto node = context.createObject(raco::user_types::Mesh::typeDescription.typeName, "Mesh Name");
+	context.set({node, {"uri"}}, cwd_path().append("meshes/Duck.glb").string());
+	dispatch();
+
+	auto adaptor = sceneContext.lookup<raco::ramses_adaptor::MeshAdaptor>(node);
+	auto mesh = std::dynamic_pointer_cast<raco::user_types::Mesh>(node)->meshData();
+	ASSERT_LT(mesh->numVertices(), 65536);
+	EXPECT_EQ(adaptor->indicesPtr()->getDataType(), ramses::EDataType::UInt16);
+	EXPECT_EQ(adaptor->indicesPtr()->getNumberOfElements(), mesh->getIndices().size());
+}
+
+TEST_F(MeshAdaptorTest, mesh_with_65536_vertices_uses_16_bit_indices) {
+	IndexOnlyMesh mesh(65536);
+	auto indices = raco::ramses_adaptor::MeshAdaptor::createIndexResource(sceneContext.scene(), mesh);
+	EXPECT_EQ(indices->getDataType(), ramses::EDataType::UInt16);
+	EXPECT_EQ(indices->getNumberOfElements(), 3);
+}
+
+TEST_F(MeshAdaptorTest, mesh_with_65537_vertices_uses_32_bit_indices) {
+	IndexOnlyMesh mesh(65537);
+	auto indices = raco::ramses_adaptor::MeshAdaptor::createIndexResource(sceneContext.scene(), mesh);
+	EXPECT_EQ(indices->getDataType(), ramses::EDataType::UInt32);
+	EXPECT_EQ(indices->getNumberOfElements(), 3);
+}
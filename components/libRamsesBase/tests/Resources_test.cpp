@@ -13,6 +13,8 @@
 #include "ramses_adaptor/TextureSamplerAdaptor.h"
 #include "ramses_adaptor/SceneAdaptor.h"
 #include "ramses_adaptor/utilities.h"
+#include "ramses_base/TextureDataCache.h"
+#include "user_types/CubeMap.h"
 
 using namespace raco;
 
@@ -40,3 +42,82 @@ TEST_F(ResourcesAdaptorFixture, texture_name_change) {
 		EXPECT_STREQ("Changed", engineTextures[0]->getName());
 	}
 }
+
+TEST_F(ResourcesAdaptorFixture, texture_sampler_change_keeps_texture_data) {
+	auto texture = create<user_types::Texture>("texture");
+	context.set({texture, {"uri"}}, (cwd_path() / "images" / "DuckCM.png").string());
+	dispatch();
+
+	auto adaptor = sceneContext.lookup<ramses_adaptor::TextureSamplerAdaptor>(texture);
+	auto textureData = adaptor->textureData();
+	ASSERT_TRUE(textureData);
+
+	context.set({texture, {"wrapUMode"}}, static_cast<int>(ramses::ETextureAddressMode_Mirror));
+	context.set({texture, {"anisotropy"}}, 4);
+	dispatch();
+
+	EXPECT_EQ(adaptor->textureData(), textureData);
+	auto engineSamplers{select<ramses::TextureSampler>(*sceneContext.scene(), ramses::ERamsesObjectType::ERamsesObjectType_TextureSampler)};
+	ASSERT_EQ(engineSamplers.size(), 1);
+	EXPECT_EQ(engineSamplers[0]->getWrapUMode(), ramses::ETextureAddressMode_Mirror);
+	EXPECT_EQ(engineSamplers[0]->getAnisotropyLevel(), 4);
+
+	context.set({texture, {"origin"}}, 1 - *texture->origin_);
+	dispatch();
+
+	EXPECT_NE(adaptor->textureData(), textureData);
+}
+
+TEST_F(ResourcesAdaptorFixture, texture_data_cache_shares_decoded_images) {
+	auto& cache = ramses_base::TextureDataCache::instance();
+	cache.clear();
+	auto misses = cache.missCount();
+
+	auto uri = (cwd_path() / "images" / "DuckCM.png").string();
+	auto first = create<user_types::Texture>("first");
+	auto second = create<user_types::Texture>("second");
+	context.set({first, {"uri"}}, uri);
+	context.set({second, {"uri"}}, uri);
+	dispatch();
+
+	EXPECT_EQ(cache.missCount(), misses + 1);
+	EXPECT_EQ(cache.entryCount(), 1);
+	auto bytes = cache.bytesHeld();
+	EXPECT_GT(bytes, 0);
+
+	// Different origin needs a separately flipped image.
+	context.set({second, {"origin"}}, 1 - *second->origin_);
+	dispatch();
+	EXPECT_EQ(cache.missCount(), misses + 2);
+	EXPECT_EQ(cache.bytesHeld(), 2 * bytes);
+
+	auto budget = cache.memoryBudget();
+	cache.setMemoryBudget(bytes);
+	EXPECT_EQ(cache.entryCount(), 1);
+	EXPECT_EQ(cache.bytesHeld(), bytes);
+	cache.setMemoryBudget(budget);
+
+	cache.invalidate(uri);
+	EXPECT_EQ(cache.entryCount(), 0);
+	EXPECT_EQ(cache.bytesHeld(), 0);
+}
+
+TEST_F(ResourcesAdaptorFixture, cube_map_faces_decoded_before_sync) {
+	auto& cache = ramses_base::TextureDataCache::instance();
+	cache.clear();
+	auto misses = cache.missCount();
+	auto hits = cache.hitCount();
+
+	auto cubeMap = create<user_types::CubeMap>("cube map");
+	for (const auto& [property, file] : std::vector<std::pair<std::string, std::string>>{
+			 {"uriFront", "text-front.png"}, {"uriBack", "text-back.png"}, {"uriLeft", "text-left.png"}, {"uriRight", "text-right.png"}, {"uriTop", "text-top.png"}, {"uriBottom", "text-bottom.png"}}) {
+		context.set({cubeMap, {property}}, (cwd_path() / "images" / file).string());
+	}
+	dispatch();
+
+	// All faces are decoded in the parallel stage, the adaptor only finds them in the cache.
+	EXPECT_EQ(cache.missCount(), misses + 6);
+	EXPECT_EQ(cache.hitCount(), hits + 6);
+	EXPECT_EQ(cache.entryCount(), 6);
+	EXPECT_FALSE(errors.hasError({cubeMap, {"uriFront"}}));
+}
@@ -0,0 +1,59 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "RamsesBaseFixture.h"
+#include "user_types/MeshNode.h"
+#include "user_types/Node.h"
+
+#include <gtest/gtest.h>
+
+using raco::core::SEditorObject;
+using raco::core::ValueHandle;
+using raco::user_types::MeshNode;
+using raco::user_types::Node;
+
+// The bulk engine update must only visit the objects affected by a change, independent of the number of objects in the project.
+// Timings are measured by the SceneAdaptor benchmark in the benchmarks directory.
+class SceneAdaptorPerformanceTest : public RamsesBaseFixture<> {
+protected:
+	void growProject(size_t numInstances) {
+		while (project.instances().size() < numInstances) {
+			auto parent = context.createObject(Node::typeDescription.typeName, "Parent");
+			auto child = context.createObject(MeshNode::typeDescription.typeName, "Child");
+			context.moveScenegraphChild(child, parent);
+		}
+		dataChangeDispatcher->dispatch(recorder.release());
+	}
+
+	// Number of objects visited by the bulk update syncing a single property change.
+	size_t visitedForSingleChange(SEditorObject object, double value) {
+		context.set(ValueHandle{object, {"translation", "x"}}, value);
+		dataChangeDispatcher->dispatch(recorder.release());
+		return sceneContext.bulkUpdateVisitedObjects();
+	}
+};
+
+TEST_F(SceneAdaptorPerformanceTest, single_change_visits_independent_of_project_size) {
+	auto node = context.createObject(Node::typeDescription.typeName, "Changed");
+
+	growProject(500);
+	auto smallProjectVisited = visitedForSingleChange(node, 1.0);
+
+	growProject(2000);
+	auto largeProjectVisited = visitedForSingleChange(node, 2.0);
+
+	EXPECT_GE(smallProjectVisited, 1);
+	EXPECT_EQ(largeProjectVisited, smallProjectVisited);
+
+	auto engineNode = select<ramses::Node>(*sceneContext.scene(), "Changed");
+	float x, y, z;
+	engineNode->getTranslation(x, y, z);
+	EXPECT_EQ(x, 2.0f);
+}
@@ -317,6 +317,34 @@ TEST_F(SceneContextTest, dataChange_dynamicReparenting_noParent) {
 	EXPECT_EQ(static_cast<ramses::MeshNode*>(meshNodeSceneElements.at(0))->getParent(), nullptr);
 }
 
+TEST_F(SceneContextTest, dataChange_referenceToObjectCreatedAfterFirstUpdate) {
+	auto meshNode = context.createObject(MeshNode::typeDescription.typeName, "MeshNode");
+	dispatch();
+
+	auto mesh = context.createObject(Mesh::typeDescription.typeName, "Mesh");
+	auto parent = context.createObject(Node::typeDescription.typeName, "Parent");
+	context.set(raco::core::ValueHandle{mesh, {"uri"}}, (cwd_path() / "meshes/Duck.glb").string());
+	context.set(raco::core::ValueHandle{meshNode, {"mesh"}}, mesh);
+	context.moveScenegraphChild({meshNode}, {parent});
+	dispatch();
+
+	auto meshStuff{select<ramses::ArrayResource>(*sceneContext.scene(), ramses::ERamsesObjectType::ERamsesObjectType_ArrayResource)};
+	EXPECT_EQ(meshStuff.size(), 4);
+	EXPECT_TRUE(isRamsesNameInArray("Mesh_MeshIndexData", meshStuff));
+	EXPECT_FALSE(isRamsesNameInArray(raco::ramses_adaptor::defaultIndexDataBufferName, meshStuff));
+
+	auto ramsesMeshNode = select<ramses::MeshNode>(*sceneContext.scene(), "MeshNode");
+	auto ramsesParent = select<ramses::Node>(*sceneContext.scene(), "Parent");
+	EXPECT_EQ(ramsesMeshNode->getParent(), ramsesParent);
+
+	context.set(raco::core::ValueHandle{mesh, {"objectName"}}, std::string("Renamed"));
+	dispatch();
+
+	meshStuff = select<ramses::ArrayResource>(*sceneContext.scene(), ramses::ERamsesObjectType::ERamsesObjectType_ArrayResource);
+	EXPECT_EQ(meshStuff.size(), 4);
+	EXPECT_TRUE(isRamsesNameInArray("Renamed_MeshIndexData", meshStuff));
+}
+
 TEST_F(SceneContextTest, construction_createSceneWithDeeperHierarchy_reverseNodeCreation2) {
 	auto rootNode = context.createObject(Node::typeDescription.typeName, "Root", "root1");
 	auto childNode = context.createObject(Node::typeDescription.typeName, "Child1", "child1");
@@ -8,6 +8,7 @@
  * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include "ramses_base/ShaderInterfaceCache.h"
 #include "ramses_base/Utils.h"
 #include "RamsesBaseFixture.h"
 #include <gtest/gtest.h>
@@ -72,3 +73,91 @@ end
 		EXPECT_EQ(EnginePrimitive::Double, in.at(0).children.at(i).type);
 	}
 }
+
+namespace {
+const std::string testVertexShader = R"(
+#version 300 es
+precision mediump float;
+in vec3 a_Position;
+uniform mat4 mvpMatrix;
+void main() {
+	gl_Position = mvpMatrix * vec4(a_Position.xyz, 1.0);
+}
+)";
+const std::string testFragmentShader = R"(
+#version 300 es
+precision mediump float;
+uniform vec4 u_color;
+out vec4 FragColor;
+void main() {
+	FragColor = u_color;
+}
+)";
+}  // namespace
+
+TEST_F(UtilsTest, shaderInterfaceCache_parses_once) {
+	ShaderInterfaceCache cache;
+	const auto& first = cache.parse(backend.internalScene(), testVertexShader, std::string(), testFragmentShader, std::string());
+	EXPECT_TRUE(first.success);
+	EXPECT_EQ(first.attributes.size(), 1);
+	EXPECT_EQ(cache.missCount(), 1);
+
+	const auto& second = cache.parse(backend.internalScene(), testVertexShader, std::string(), testFragmentShader, std::string());
+	EXPECT_EQ(&first, &second);
+	EXPECT_EQ(cache.hitCount(), 1);
+
+	cache.parse(backend.internalScene(), testVertexShader, std::string(), testFragmentShader, "DEFINE_A");
+	EXPECT_EQ(cache.missCount(), 2);
+	EXPECT_EQ(cache.size(), 2);
+}
+
+TEST_F(UtilsTest, shaderInterfaceCache_persists_to_file) {
+	auto cacheFile = (cwd_path() / "shader_interface_cache.bin").string();
+	{
+		ShaderInterfaceCache cache;
+		cache.setCacheFile(cacheFile);
+		cache.parse(backend.internalScene(), testVertexShader, std::string(), testFragmentShader, std::string());
+		cache.parse(backend.internalScene(), "invalid", std::string(), testFragmentShader, std::string());
+		EXPECT_TRUE(cache.save());
+	}
+
+	ShaderInterfaceCache cache;
+	cache.setCacheFile(cacheFile);
+	EXPECT_EQ(cache.size(), 2);
+
+	const auto& valid = cache.parse(backend.internalScene(), testVertexShader, std::string(), testFragmentShader, std::string());
+	EXPECT_TRUE(valid.success);
+	ASSERT_EQ(valid.uniforms.size(), 1);
+	EXPECT_EQ(valid.uniforms[0].name, "u_color");
+	EXPECT_EQ(valid.attributes.size(), 1);
+	EXPECT_EQ(valid.attributes[0].name, "a_Position");
+	EXPECT_EQ(valid.attributes[0].type, EnginePrimitive::Vec3f);
+
+	const auto& invalid = cache.parse(backend.internalScene(), "invalid", std::string(), testFragmentShader, std::string());
+	EXPECT_FALSE(invalid.success);
+	EXPECT_FALSE(invalid.error.empty());
+
+	EXPECT_EQ(cache.hitCount(), 2);
+	EXPECT_EQ(cache.missCount(), 0);
+}
+
+TEST_F(UtilsTest, shaderInterfaceCache_digest_separates_sources) {
+	auto digest = ShaderInterfaceCache::computeDigest("ab", std::string(), "c", std::string());
+	EXPECT_EQ(digest.size(), 32);
+	EXPECT_EQ(digest, ShaderInterfaceCache::computeDigest("ab", std::string(), "c", std::string()));
+	EXPECT_NE(digest, ShaderInterfaceCache::computeDigest("a", "b", "c", std::string()));
+	EXPECT_NE(digest, ShaderInterfaceCache::computeDigest("ab", std::string(), std::string(), "c"));
+}
+
+TEST_F(UtilsTest, shaderInterfaceCache_save_leaves_no_temporary_files) {
+	auto cacheDirectory = cwd_path() / "shader_cache_dir";
+	{
+		ShaderInterfaceCache cache;
+		cache.setCacheFile((cacheDirectory / "cache.bin").string());
+		cache.parse(backend.internalScene(), testVertexShader, std::string(), testFragmentShader, std::string());
+		EXPECT_TRUE(cache.save());
+	}
+	std::vector<std::filesystem::path> files(std::filesystem::directory_iterator(cacheDirectory), std::filesystem::directory_iterator());
+	ASSERT_EQ(files.size(), 1);
+	EXPECT_EQ(files[0].filename(), "cache.bin");
+}
@@ -15,6 +15,8 @@
 
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace raco::core {
@@ -69,7 +71,7 @@ public:
 	// Get the set of all changes Values
 	// - added/removed properties inside Tables will be recorded as change of the Table Value.
 	//   No separate add/remove property notification is generated.
-	std::map<std::string, std::set<ValueHandle>> const& getChangedValues() const;
+	std::unordered_map<std::string, std::unordered_set<ValueHandle>> const& getChangedValues() const;
 
 	bool hasValueChanged(const ValueHandle& handle) const;
 
@@ -81,7 +83,7 @@ public:
 	// that have been created of which contain a changed Value.
 	std::set<SEditorObject> getAllChangedObjects(bool includePreviewDirty = false, bool includeLinkStart = false, bool includeLinkEnd = false) const;
 
-	std::set<ValueHandle> getChangedErrors() const;
+	std::unordered_set<ValueHandle> const& getChangedErrors() const;
 
 	std::set<SEditorObject> getPreviewDirtyObjects() const;
 
@@ -120,13 +122,13 @@ private:
 	std::set<SEditorObject> createdObjects_;
 	std::set<SEditorObject> deletedObjects_;
 	
-	std::map<std::string, std::set<ValueHandle>> changedValues_;
+	std::unordered_map<std::string, std::unordered_set<ValueHandle>> changedValues_;
 
 	LinkMap addedLinks_;
 	LinkMap changedValidityLinks_;
 	LinkMap removedLinks_;
 
-	std::set<ValueHandle> changedErrors_;
+	std::unordered_set<ValueHandle> changedErrors_;
 	std::set<SEditorObject> previewDirty_;
 
 	bool externalProjectMapChanged_ = false;
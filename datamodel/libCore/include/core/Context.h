@@ -85,6 +85,10 @@ public:
 	// Remove all properties from Table
 	void removeAllProperties(const ValueHandle &handle);
 
+	// Store the properties of a Table contiguously if possible, see Table::makeDense.
+	// Doesn't change the value of the Table, so no changes are recorded.
+	bool makeTableDense(const ValueHandle& handle);
+
 	// Object creation/deletion
 	SEditorObject createObject(std::string type, std::string name = std::string(), std::string id = std::string());
 
@@ -14,6 +14,7 @@
 #include "core/Handles.h"
 #include "core/Link.h"
 #include "core/EngineInterface.h"
+#include "core/MeshCacheInterface.h"
 #include <spdlog/fmt/fmt.h>
 #include <sstream>
 
@@ -152,3 +153,11 @@ struct fmt::formatter<raco::core::LinkDescriptor> : formatter<string_view> {
 	}
 };
 
+template <>
+struct fmt::formatter<raco::core::MeshCacheStatistics> : formatter<string_view> {
+	template <typename FormatContext>
+	auto format(const raco::core::MeshCacheStatistics& s, FormatContext& ctx) {
+		return fmt::format_to(ctx.out(), "{} hits, {} misses, {} evictions, {} entries holding {} of {} bytes",
+			s.hits, s.misses, s.evictions, s.entries, s.bytesHeld, s.memoryBudget);
+	}
+};
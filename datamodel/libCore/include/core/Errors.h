@@ -15,7 +15,7 @@
 #include "core/Handles.h"
 #include "log_system/log.h"
 
-#include <map>
+#include <unordered_map>
 
 namespace raco::core {
 
@@ -59,10 +59,10 @@ public:
 	/**
 	 * @returns read-only reference to all saved errors.
 	 */
-	const std::map<ValueHandle, ErrorItem>& getAllErrors() const;
+	const std::unordered_map<ValueHandle, ErrorItem>& getAllErrors() const;
 
 private:
-	std::map<ValueHandle, ErrorItem> errors_;
+	std::unordered_map<ValueHandle, ErrorItem> errors_;
 	DataChangeRecorder* recorder_;
 };
 
@@ -11,7 +11,9 @@
 
 #include "data_storage/Value.h"
 #include "core/PropertyDescriptor.h"
+#include "core/PropertyIndexPath.h"
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -49,13 +51,17 @@ class ValueTreeIterator;
 //   invalidating the ValueHandle. The validity can be checked using the "operator bool()".
 //   Deletion of an object from the Project can not be detected using the ValueHandle alone since it is possible
 //   that the shared pointer of the root object is kept alive elsewhere.
+// - the property is located by an interned PropertyIndexPath: copying, comparing and hashing ValueHandles
+//   is cheap, which makes them suitable as keys in hash containers.
 class ValueHandle {
 public:
 	ValueHandle(std::shared_ptr<EditorObject> object = nullptr, std::initializer_list<std::string> names = std::initializer_list<std::string>());
 	ValueHandle(const std::shared_ptr<EditorObject>& object, const std::vector<std::string>& names);
 
 	ValueHandle(std::shared_ptr<EditorObject> object, std::initializer_list<size_t> indices);
-	ValueHandle(const std::shared_ptr<EditorObject>& object, const std::vector<size_t>& indices) : object_(object), indices_(indices) {
+	ValueHandle(const std::shared_ptr<EditorObject>& object, const std::vector<size_t>& indices) : object_(object), path_(PropertyIndexPath::fromIndices(indices)) {
+	}
+	ValueHandle(const std::shared_ptr<EditorObject>& object, const PropertyIndexPath* path) : object_(object), path_(path) {
 	}
 
 	ValueHandle(const PropertyDescriptor& property) : ValueHandle(property.object(), property.propertyNames()) {
@@ -97,10 +103,10 @@ public:
 
 	template<class C>
 	std::shared_ptr<C> asTypedRef() const {
-		if (indices_.empty()) {
+		if (path_->depth() == 0) {
 			return std::dynamic_pointer_cast<C>(object_);
 		}
-		ValueBase* v = valueRef();
+		const ValueBase* v = constValueRef();
 		if (v) {
 			return std::dynamic_pointer_cast<C>(v->asRef());
 		}
@@ -143,9 +149,17 @@ public:
 	// Nesting level of property.
 	size_t depth() const;
 	
-	bool operator==(const ValueHandle& right) const;
+	bool operator==(const ValueHandle& right) const {
+		return object_ == right.object_ && path_ == right.path_;
+	}
+	// Ordered by root object address, then lexicographically by property indices.
 	bool operator<(const ValueHandle& right) const;
 
+	size_t hash() const {
+		size_t objectHash = std::hash<const EditorObject*>()(object_.get());
+		return objectHash ^ (path_->hash() + 0x9e3779b9 + (objectHash << 6) + (objectHash >> 2));
+	}
+
 	ValueHandle& nextSibling();
 
 	const ValueBase* constValueRef() const;
@@ -159,7 +173,7 @@ private:
 	ReflectionInterface* object() const;
 
 	std::shared_ptr<EditorObject> object_;
-	std::vector<size_t> indices_;
+	const PropertyIndexPath* path_;
 };
 
 
@@ -238,4 +252,15 @@ private:
 	std::string valueName_;
 };
 
-}
\ No newline at end of file
+}  // namespace raco::core
+
+namespace std {
+
+template <>
+struct hash<raco::core::ValueHandle> {
+	size_t operator()(const raco::core::ValueHandle& handle) const {
+		return handle.hash();
+	}
+};
+
+}  // namespace std
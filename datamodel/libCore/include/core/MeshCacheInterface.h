@@ -20,6 +20,48 @@
 
 namespace raco::core {
 
+// Immutable view of a mesh buffer which shares ownership of the underlying storage.
+// Copying the view is cheap and never copies the buffer content.
+template <typename T>
+class SharedBuffer {
+public:
+	SharedBuffer() = default;
+
+	SharedBuffer(std::shared_ptr<const void> owner, const T* data, size_t size) : owner_(std::move(owner)), data_(data), size_(size) {}
+
+	// Take over the vector content without copying it.
+	explicit SharedBuffer(std::vector<T>&& data) {
+		auto storage = std::make_shared<const std::vector<T>>(std::move(data));
+		data_ = storage->data();
+		size_ = storage->size();
+		owner_ = std::move(storage);
+	}
+
+	const T* data() const {
+		return data_;
+	}
+	size_t size() const {
+		return size_;
+	}
+	bool empty() const {
+		return size_ == 0;
+	}
+	const T& operator[](size_t index) const {
+		return data_[index];
+	}
+	const T* begin() const {
+		return data_;
+	}
+	const T* end() const {
+		return data_ + size_;
+	}
+
+private:
+	std::shared_ptr<const void> owner_;
+	const T* data_{nullptr};
+	size_t size_{0};
+};
+
 // Single mesh that can be handed over to Ramses.
 // May contain only part of an entire file; see MeshCacheEntry.
 class MeshData {
@@ -48,10 +90,14 @@ public:
 
 	virtual uint32_t numTriangles() const = 0;
 	virtual uint32_t numVertices() const = 0;
+	//! Number of triangles before the mesh was simplified for a level of detail.
+	virtual uint32_t numFullDetailTriangles() const {
+		return numTriangles();
+	}
 
 	virtual std::vector<std::string> getMaterialNames() const = 0;
 
-	virtual const std::vector<uint32_t>& getIndices() const = 0;
+	virtual SharedBuffer<uint32_t> getIndices() const = 0;
 
 	virtual const std::vector<IndexBufferRangeInfo>& submeshIndexBufferRanges() const = 0;
 
@@ -61,6 +107,7 @@ public:
 	virtual uint32_t attribDataSize(int attribIndex) const = 0;
 	virtual uint32_t attribElementCount(int attribIndex) const  = 0;
 	virtual VertexAttribDataType attribDataType(int attribIndex) const = 0;
+	//! Valid as long as the MeshData object exists.
 	virtual const char* attribBuffer(int attribIndex) const = 0;
 
 	int attribIndex(const std::string& name) const {
@@ -71,6 +118,15 @@ public:
 		}
 		return -1;
 	}
+
+	//! Size of the index and attribute buffers in bytes.
+	size_t memoryUsage() const {
+		size_t size = getIndices().size() * sizeof(uint32_t);
+		for (uint32_t i{0}; i < numAttributes(); i++) {
+			size += attribDataSize(i);
+		}
+		return size;
+	}
 };
 
 using SharedMeshData = std::shared_ptr<MeshData>;
@@ -114,6 +170,12 @@ struct MeshDescriptor {
 	std::string absPath{};
 	int submeshIndex{0};
 	bool bakeAllSubmeshes{true};
+	// Reorder vertices and triangles for vertex cache efficiency and reduced overdraw, see mesh_loader/MeshOptimizer.h.
+	bool optimizeMesh{false};
+	// Round vertex attributes to the precision of compact encodings, see mesh_loader/MeshOptimizer.h.
+	bool quantizeAttributes{false};
+	// Level of detail: 0 is the full mesh, every further level is simplified to about half the triangles of the previous one.
+	int lodLevel{0};
 };
 
 // Cache entry for each file.
@@ -136,21 +198,45 @@ public:
 	virtual MeshScenegraph getScenegraph(bool bakeAllSubmeshes) = 0;
 
 	virtual int getTotalMeshCount(bool bakeAllSubmeshes) = 0;
+
+	// Approximate memory in bytes held by the importer for the currently loaded file.
+	virtual size_t memoryUsage() const = 0;
 };
 
 using UniqueMeshCacheEntry = std::unique_ptr<MeshCacheEntry>;
 
+struct MeshCacheStatistics {
+	size_t hits{0};
+	size_t misses{0};
+	size_t evictions{0};
+	size_t entries{0};
+	size_t bytesHeld{0};
+	size_t memoryBudget{0};
+};
+
 class MeshCache : public FileChangeMonitor {
 public:
+	using LoadCallback = std::function<void(SharedMeshData)>;
+	// Handle of an asynchronous load; destroying the handle cancels the load.
+	using LoadHandle = std::unique_ptr<void, std::function<void(void*)>>;
+
 	virtual ~MeshCache() = default;
 
 	virtual SharedMeshData loadMesh(const raco::core::MeshDescriptor& descriptor) = 0;
+
+	// Load the mesh on a worker thread if asynchronous loading is enabled; otherwise the callback is invoked before returning.
+	// The callback is invoked on the main thread by processCompletedLoads unless the handle has been destroyed before.
+	virtual LoadHandle loadMeshAsync(const raco::core::MeshDescriptor& descriptor, LoadCallback callback) = 0;
+	virtual void processCompletedLoads() = 0;
+	virtual bool hasPendingLoads() const = 0;
 	
 	virtual MeshScenegraph getMeshScenegraph(const std::string& absPath, bool bakeAllSubmeshes) = 0;
 	virtual std::string getMeshError(const std::string& absPath) = 0;
 
 	virtual int getTotalMeshCount(const std::string& absPath, bool bakeAllSubmeshes) = 0;
 
+	virtual MeshCacheStatistics statistics() const = 0;
+
 protected:
 	virtual MeshCacheEntry* getLoader(std::string absPath) = 0;
 };
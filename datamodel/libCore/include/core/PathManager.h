@@ -27,6 +27,8 @@ struct PathManager {
 	static constexpr const char* Q_LAYOUT_FILE_NAME = "layout.ini";
 	static constexpr const char* Q_PREFERENCES_FILE_NAME = "preferences.ini";
 	static constexpr const char* Q_RECENT_FILES_STORE_NAME = "recent_files.ini";
+	static constexpr const char* SHADER_CACHE_FILE_NAME = "shader_interface_cache.bin";
+	static constexpr const char* MESH_CACHE_SUB_DIRECTORY = "meshcache";
 	static constexpr const char* DEFAULT_CONFIG_SUB_DIRECTORY = "configfiles";
 	static constexpr const char* DEFAULT_PROJECT_SUB_DIRECTORY = "projects";
 	static constexpr const char* RESOURCE_SUB_DIRECTORY = "resources";
@@ -55,6 +57,10 @@ struct PathManager {
 
 	static std::string preferenceFileLocation();
 
+	static std::string shaderCacheFilePath();
+
+	static std::string meshCacheDirectory();
+
 	static std::string constructRelativePath(const std::string& absolutePath, const std::string& basePath);
 
 	// Construct absolute paths from base directory and relative  or absolute file path.
@@ -0,0 +1,82 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace raco::core {
+
+// Interned sequence of property indices locating a nested property relative to its root object.
+// - every distinct index sequence is represented by exactly one PropertyIndexPath, so paths are
+//   compared by address and hashed using a precomputed hash
+// - paths form a trie starting at root(). Each path only stores its parent and its last index;
+//   child paths are created on first use in a table shared by all paths, keyed by parent and index.
+// - paths are never freed: their number grows with the distinct index sequences ever used. For
+//   Table properties like Lua arrays this includes every element index seen, so it is bounded by
+//   the largest Tables used rather than by the property types. Each path takes a few words.
+// - lookup and creation of child paths is thread-safe.
+class PropertyIndexPath {
+public:
+	PropertyIndexPath(const PropertyIndexPath&) = delete;
+	PropertyIndexPath& operator=(const PropertyIndexPath&) = delete;
+
+	// The empty path referring to the root object itself.
+	static const PropertyIndexPath* root();
+
+	static const PropertyIndexPath* fromIndices(const std::vector<size_t>& indices);
+
+	// Number of paths created so far, including the root path.
+	static size_t internedCount();
+
+	// Path extended by one more index.
+	const PropertyIndexPath* child(size_t index) const;
+
+	// Path with the last index removed; nullptr for the root path.
+	const PropertyIndexPath* parent() const {
+		return parent_;
+	}
+
+	// Ancestor of this path (or the path itself) with the given depth.
+	const PropertyIndexPath* prefix(size_t depth) const;
+
+	// All indices from the root object on, collected by walking up the parents.
+	std::vector<size_t> indices() const;
+
+	size_t depth() const {
+		return depth_;
+	}
+
+	// Last index; must not be used on the root path.
+	size_t back() const {
+		return index_;
+	}
+
+	size_t hash() const {
+		return hash_;
+	}
+
+	// Check if 'other' is nested strictly inside this path.
+	bool contains(const PropertyIndexPath* other) const;
+
+	// Lexicographic order of the index sequences.
+	bool lessThan(const PropertyIndexPath* other) const;
+
+private:
+	PropertyIndexPath(const PropertyIndexPath* parent, size_t index);
+	PropertyIndexPath();
+
+	const PropertyIndexPath* parent_;
+	size_t index_;
+	size_t depth_;
+	size_t hash_;
+};
+
+}  // namespace raco::core
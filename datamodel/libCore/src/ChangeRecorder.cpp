@@ -233,7 +233,7 @@ std::set<SEditorObject> const& DataChangeRecorder::getDeletedObjects() const {
 	return deletedObjects_;
 }
 
-std::map<std::string, std::set<ValueHandle>> const& DataChangeRecorder::getChangedValues() const {
+std::unordered_map<std::string, std::unordered_set<ValueHandle>> const& DataChangeRecorder::getChangedValues() const {
 	return changedValues_;
 }
 
@@ -283,7 +283,7 @@ std::set<SEditorObject> DataChangeRecorder::getAllChangedObjects(bool includePre
 	return objects;
 }
 
-std::set<ValueHandle> DataChangeRecorder::getChangedErrors() const {
+std::unordered_set<ValueHandle> const& DataChangeRecorder::getChangedErrors() const {
 	return changedErrors_;
 }
 
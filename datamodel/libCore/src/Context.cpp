@@ -247,6 +247,10 @@ void BaseContext::removeAllProperties(const ValueHandle& handle) {
 	}
 }
 
+bool BaseContext::makeTableDense(const ValueHandle& handle) {
+	return handle.valueRef()->asTable().makeDense();
+}
+
 namespace {
 std::vector<SEditorObject> collectObjectsForCopyOrCutOperations(const std::vector<SEditorObject>& objects, bool deep) {
 	std::set<SEditorObject> toCheck{objects.begin(), objects.end()};
@@ -551,7 +555,7 @@ std::vector<SEditorObject> BaseContext::pasteObjects(const std::string& seralize
 }
 
 ValueTreeIterator BaseContext::erase(const ValueTreeIterator& it) {
-	removeProperty(it->parent(), it->indices_.back());
+	removeProperty(it->parent(), it->path_->back());
 	return ValueTreeIterator::normalized(it);
 }
 
@@ -89,7 +89,7 @@ bool Errors::removeIf(const std::function<bool(ErrorItem const&)>& predicate) {
 	return hasChanged;
 }
 
-const std::map<ValueHandle, ErrorItem>& Errors::getAllErrors() const {
+const std::unordered_map<ValueHandle, ErrorItem>& Errors::getAllErrors() const {
 	return errors_;
 }
 
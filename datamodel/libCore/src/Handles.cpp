@@ -14,20 +14,59 @@
 
 namespace raco::core {
 
+namespace {
+
+// Resolve the parent path first instead of collecting the indices of the path, which would need an allocation.
+// Uses the const interface if Reflection is const so that Tables shared with copies of the object stay shared.
+template <typename Reflection, typename Value>
+Value* resolvePath(Reflection* object, const PropertyIndexPath* path) {
+	Reflection* container = object;
+	if (path->depth() > 1) {
+		Value* parentValue = resolvePath<Reflection, Value>(object, path->parent());
+		if (!parentValue || !hasTypeSubstructure(parentValue->type())) {
+			return nullptr;
+		}
+		container = &parentValue->getSubstructure();
+	}
+	return container->get(path->back());
+}
+
+// ReflectionInterface containing the last property of a non-empty path.
+const ReflectionInterface* propertyContainer(const ReflectionInterface* object, const PropertyIndexPath* path) {
+	if (path->depth() > 1) {
+		return &resolvePath<const ReflectionInterface, const ValueBase>(object, path->parent())->getSubstructure();
+	}
+	return object;
+}
+
+// Call 'function' with the names of the properties along a non-empty path, starting at the object.
+// Returns the ReflectionInterface containing the last property of the path.
+template <typename Function>
+const ReflectionInterface* visitPropertyNames(const ReflectionInterface* object, const PropertyIndexPath* path, Function&& function) {
+	const ReflectionInterface* container = object;
+	if (path->depth() > 1) {
+		auto parent = path->parent();
+		container = &visitPropertyNames(object, parent, function)->get(parent->back())->getSubstructure();
+	}
+	function(container->name(path->back()));
+	return container;
+}
+
+}  // namespace
+
 ValueHandle::ValueHandle(std::shared_ptr<EditorObject> object, std::initializer_list<std::string> names) : ValueHandle(object, std::vector<std::string>(names)) {}
 
 ValueHandle::ValueHandle(const std::shared_ptr<EditorObject>& object, const std::vector<std::string>& names)
-	: object_(object), indices_(names.size()) {
-	indices_.resize(0);
+	: object_(object), path_(PropertyIndexPath::root()) {
 	const ReflectionInterface* o = object_.get();
 	for (const auto& name : names) {
 		int index = o->index(name);
 		if (index == -1) {
 			object_ = nullptr;
-			indices_.clear();
+			path_ = PropertyIndexPath::root();
 			break;
 		}
-		indices_.push_back(index);
+		path_ = path_->child(index);
 
 		const ValueBase* val = o->get(index);
 		if (hasTypeSubstructure(val->type())) {
@@ -37,11 +76,11 @@ ValueHandle::ValueHandle(const std::shared_ptr<EditorObject>& object, const std:
 }
 
 ValueHandle::ValueHandle(std::shared_ptr<EditorObject> object, std::initializer_list<size_t> indices)
-	: object_(object), indices_(indices) {
+	: object_(object), path_(PropertyIndexPath::fromIndices(indices)) {
 }
 
 ValueHandle ValueHandle::translatedHandle(const ValueHandle& handle, SEditorObject newObject) {
-	return ValueHandle(handle.object_ ? newObject : nullptr, handle.indices_);
+	return ValueHandle(handle.object_ ? newObject : nullptr, handle.path_);
 }
 
 ValueHandle ValueHandle::translatedHandle(const ValueHandle& handle, std::function<SEditorObject(SEditorObject)> translateRef) {
@@ -78,35 +117,35 @@ std::string ValueHandle::as<std::string>() const {
 }
 
 bool ValueHandle::asBool() const {
-	ValueBase* v = valueRef();
+	const ValueBase* v = constValueRef();
 	return v->asBool();
 }
 
 int ValueHandle::asInt() const {
-	ValueBase* v = valueRef();
+	const ValueBase* v = constValueRef();
 	return v->asInt();
 }
 
 double ValueHandle::asDouble() const {
-	ValueBase* v = valueRef();
+	const ValueBase* v = constValueRef();
 	return v->asDouble();
 }
 
 std::string ValueHandle::asString() const {
-	ValueBase* v = valueRef();
+	const ValueBase* v = constValueRef();
 	return v->asString();
 }
 
 SEditorObject ValueHandle::asRef() const {
-	ValueBase* v = valueRef();
+	const ValueBase* v = constValueRef();
 	return v->asRef();
 }
 
 size_t ValueHandle::size() const {
-	if (indices_.empty()) {
+	if (isObject()) {
 		return object_->size();
 	}
-	auto v = valueRef();
+	auto v = constValueRef();
 	if (hasTypeSubstructure(v->type())) {
 		return v->getSubstructure().size();
 	}
@@ -114,20 +153,18 @@ size_t ValueHandle::size() const {
 }
 
 PrimitiveType ValueHandle::type() const {
-	return valueRef()->type();
+	return constValueRef()->type();
 }
 
 ValueHandle ValueHandle::operator[](size_t index) const {
-	ValueHandle v(object_, indices_);
-	v.indices_.push_back(index);
-	return v;
+	return ValueHandle(object_, path_->child(index));
 }
 
 bool ValueHandle::hasProperty(std::string name) const {
-	if (indices_.empty()) {
+	if (isObject()) {
 		return object_->hasProperty(name);
 	}
-	auto v = valueRef();
+	auto v = constValueRef();
 	if (hasTypeSubstructure(v->type())) {
 		return v->getSubstructure().hasProperty(name);
 	}
@@ -135,56 +172,40 @@ bool ValueHandle::hasProperty(std::string name) const {
 }
 
 ValueHandle ValueHandle::get(std::string propertyName) const {
-	ValueHandle v(object_, indices_);
-	size_t index = object()->index(propertyName);
-	v.indices_.emplace_back(index);
-	return v;
+	size_t index = isObject() ? object_->index(propertyName) : constValueRef()->getSubstructure().index(propertyName);
+	return ValueHandle(object_, path_->child(index));
 }
 
 std::string ValueHandle::getPropName() const {
-	if (!indices_.empty()) {
-		ReflectionInterface* o = object_.get();
-
-		for (int i = 0; i < indices_.size() - 1; i++) {
-			auto v = (*o)[indices_[i]];
-			o = &v->getSubstructure();
-		}
-
-		return o->name(indices_.back());
+	if (path_->depth() > 0) {
+		return propertyContainer(object_.get(), path_)->name(path_->back());
 	}
 	throw std::runtime_error("invalid property");
 }
 
 std::vector<std::string> ValueHandle::getPropertyNamesVector() const {
-	if (!indices_.empty()) {
-		std::vector<std::string> result; 
-		ReflectionInterface* o = object_.get();
-		for (int i = 0; i < indices_.size() - 1; i++) {
-			result.emplace_back(o->name(indices_[i]));
-			auto v = (*o)[indices_[i]];
-			o = &v->getSubstructure();
-		}
-		result.emplace_back(o->name(indices_.back()));
+	if (path_->depth() > 0) {
+		std::vector<std::string> result;
+		result.reserve(path_->depth());
+		visitPropertyNames(object_.get(), path_, [&result](std::string name) {
+			result.emplace_back(std::move(name));
+		});
 		return result;
 	}
 	throw std::runtime_error("invalid property");
 }
 
 std::string ValueHandle::getPropertyPath(bool useObjectID) const {
-	if (!indices_.empty()) {
-		ReflectionInterface* o = object_.get();
+	if (path_->depth() > 0) {
 		std::string propPath;
 		if (useObjectID) {
 			propPath = object_->objectID();
 		} else {
 			propPath = object_->objectName();
 		}
-		for (int i = 0; i < indices_.size() - 1; i++) {
-			propPath += "." + o->name(indices_[i]);
-			auto v = (*o)[indices_[i]];
-			o = &v->getSubstructure();
-		}
-		propPath += "." + o->name(indices_.back());
+		visitPropertyNames(object_.get(), path_, [&propPath](const std::string& name) {
+			propPath += "." + name;
+		});
 		return propPath;
 	}
 	throw std::runtime_error("invalid property");
@@ -192,36 +213,34 @@ std::string ValueHandle::getPropertyPath(bool useObjectID) const {
 
 
 ValueHandle ValueHandle::parent() const {
-	if (indices_.empty()) {
+	if (isObject()) {
 		return ValueHandle(nullptr);
 	}
-	ValueHandle v(object_, std::vector<size_t>(indices_.begin(), indices_.begin() + indices_.size() - 1));
-	return v;
+	return ValueHandle(object_, path_->parent());
 }
 
 ValueHandle::operator bool() const {
-	if (indices_.empty()) {
+	if (isObject()) {
 		return object_ != nullptr;
 	}
 
-	return valueRef() != nullptr;
+	return constValueRef() != nullptr;
 }
 
 bool ValueHandle::isObject() const {
-	return indices_.empty();
+	return path_->depth() == 0;
 }
 
 bool ValueHandle::isProperty() const {
-	return !indices_.empty();
+	return path_->depth() != 0;
 }
 
 bool ValueHandle::hasSubstructure() const {
-	return isObject() || hasTypeSubstructure(valueRef()->type());
+	return isObject() || hasTypeSubstructure(constValueRef()->type());
 }
 
 bool ValueHandle::contains(const ValueHandle& other) const {
-	return object_ == other.object_ && indices_.size() < other.indices_.size() &&
-		   std::equal(indices_.begin(), indices_.end(), other.indices_.begin(), other.indices_.begin() + indices_.size());
+	return object_ == other.object_ && path_->contains(other.path_);
 }
 
 SEditorObject ValueHandle::rootObject() const {
@@ -229,37 +248,26 @@ SEditorObject ValueHandle::rootObject() const {
 }
 
 size_t ValueHandle::depth() const {
-	return indices_.size();
+	return path_->depth();
 }
 
 const ValueBase* ValueHandle::constValueRef() const {
-	return valueRef();
+	// Uses the const interface so that Tables shared with copies of the object stay shared.
+	if (isProperty()) {
+		return resolvePath<const ReflectionInterface, const ValueBase>(object_.get(), path_);
+	}
+	return nullptr;
 }
 
 ValueBase* ValueHandle::valueRef() const {
-	if (!indices_.empty()) {
-		ReflectionInterface* o = object_.get();
-		ValueBase* v = nullptr;
-
-		for (auto index : indices_) {
-			if (v) {
-				if (!hasTypeSubstructure(v->type())) {
-					return nullptr;
-				}
-				o = &v->getSubstructure();
-			}
-			v = (*o)[index];
-			if (!v) {
-				return nullptr;
-			}
-		}
-		return v;
+	if (isProperty()) {
+		return resolvePath<ReflectionInterface, ValueBase>(object_.get(), path_);
 	}
 	return nullptr;
 }
 
 ReflectionInterface* ValueHandle::object() const {
-	if (indices_.empty()) {
+	if (isObject()) {
 		return object_.get();
 	} else {
 		auto v = valueRef();
@@ -269,16 +277,12 @@ ReflectionInterface* ValueHandle::object() const {
 	return nullptr;
 }
 
-bool ValueHandle::operator==(const ValueHandle& right) const {
-	return object_ == right.object_ && indices_ == right.indices_;
-}
-
 bool ValueHandle::operator<(const ValueHandle& right) const {
-	return object_.get() < right.object_.get() || (object_.get() == right.object_.get() && indices_ < right.indices_);
+	return object_.get() < right.object_.get() || (object_.get() == right.object_.get() && path_ != right.path_ && path_->lessThan(right.path_));
 }
 
 ValueHandle& ValueHandle::nextSibling() {
-	++indices_.back();
+	path_ = path_->parent()->child(path_->back() + 1);
 	return *this;
 }
 
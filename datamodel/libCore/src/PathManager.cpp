@@ -53,6 +53,14 @@ std::string PathManager::preferenceFileLocation() {
 	return (std::filesystem::path(defaultConfigDirectory()) / Q_PREFERENCES_FILE_NAME).generic_string();
 }
 
+std::string PathManager::shaderCacheFilePath() {
+	return (std::filesystem::path(defaultConfigDirectory()) / SHADER_CACHE_FILE_NAME).generic_string();
+}
+
+std::string PathManager::meshCacheDirectory() {
+	return (std::filesystem::path(defaultConfigDirectory()) / MESH_CACHE_SUB_DIRECTORY).generic_string();
+}
+
 std::string PathManager::defaultProjectFallbackPath() {
 	return (defaultBaseDirectory() / DEFAULT_PROJECT_SUB_DIRECTORY).generic_string();
 }
@@ -0,0 +1,127 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "core/PropertyIndexPath.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace raco::core {
+
+namespace {
+
+using ChildKey = std::pair<const PropertyIndexPath*, size_t>;
+
+struct ChildKeyHash {
+	size_t operator()(const ChildKey& key) const {
+		auto parentHash = std::hash<const PropertyIndexPath*>()(key.first);
+		return parentHash ^ (key.second + 0x9e3779b9 + (parentHash << 6) + (parentHash >> 2));
+	}
+};
+
+// Child paths of all paths.
+struct ChildTable {
+	std::shared_mutex mutex;
+	std::unordered_map<ChildKey, std::unique_ptr<PropertyIndexPath>, ChildKeyHash> children;
+	std::atomic<size_t> count{1};
+};
+
+ChildTable& childTable() {
+	// Intentionally leaked like the root path.
+	static ChildTable* table = new ChildTable();
+	return *table;
+}
+
+}  // namespace
+
+PropertyIndexPath::PropertyIndexPath() : parent_(nullptr), index_(0), depth_(0), hash_(0) {
+}
+
+PropertyIndexPath::PropertyIndexPath(const PropertyIndexPath* parent, size_t index)
+	: parent_(parent), index_(index), depth_(parent->depth_ + 1), hash_(parent->hash_ ^ (index + 0x9e3779b9 + (parent->hash_ << 6) + (parent->hash_ >> 2))) {
+}
+
+const PropertyIndexPath* PropertyIndexPath::root() {
+	// Intentionally leaked: handles stored in static objects may still refer to paths during shutdown.
+	static const PropertyIndexPath* rootPath = new PropertyIndexPath();
+	return rootPath;
+}
+
+const PropertyIndexPath* PropertyIndexPath::fromIndices(const std::vector<size_t>& indices) {
+	const PropertyIndexPath* path = root();
+	for (auto index : indices) {
+		path = path->child(index);
+	}
+	return path;
+}
+
+size_t PropertyIndexPath::internedCount() {
+	return childTable().count;
+}
+
+const PropertyIndexPath* PropertyIndexPath::child(size_t index) const {
+	auto& table = childTable();
+	ChildKey key{this, index};
+	{
+		std::shared_lock<std::shared_mutex> lock(table.mutex);
+		auto it = table.children.find(key);
+		if (it != table.children.end()) {
+			return it->second.get();
+		}
+	}
+
+	std::unique_lock<std::shared_mutex> lock(table.mutex);
+	auto& child = table.children[key];
+	if (!child) {
+		child.reset(new PropertyIndexPath(this, index));
+		++table.count;
+	}
+	return child.get();
+}
+
+const PropertyIndexPath* PropertyIndexPath::prefix(size_t depth) const {
+	const PropertyIndexPath* path = this;
+	while (path && path->depth_ > depth) {
+		path = path->parent_;
+	}
+	return path;
+}
+
+std::vector<size_t> PropertyIndexPath::indices() const {
+	std::vector<size_t> result(depth_);
+	for (auto path = this; path->parent_; path = path->parent_) {
+		result[path->depth_ - 1] = path->index_;
+	}
+	return result;
+}
+
+bool PropertyIndexPath::contains(const PropertyIndexPath* other) const {
+	return depth_ < other->depth_ && other->prefix(depth_) == this;
+}
+
+bool PropertyIndexPath::lessThan(const PropertyIndexPath* other) const {
+	auto left = prefix(other->depth_);
+	auto right = other->prefix(depth_);
+	if (left == right) {
+		// One path is a prefix of the other.
+		return depth_ < other->depth_;
+	}
+	// Find the first position where the index sequences differ.
+	while (left->parent_ != right->parent_) {
+		left = left->parent_;
+		right = right->parent_;
+	}
+	return left->index_ < right->index_;
+}
+
+}  // namespace raco::core
@@ -45,13 +45,23 @@ void updateSingleValue(const ValueBase *src, ValueBase *dest, ValueHandle destHa
 		}
 		dest->copyAnnotationData(*src);
 	} else if (type == PrimitiveType::Table) {
-		bool srcIsArray = src->query<ArraySemanticAnnotation>();
-		bool destIsArray = dest->query<ArraySemanticAnnotation>();
-		assert((srcIsArray && destIsArray) || (!srcIsArray && !destIsArray));
-		if (srcIsArray) {
-			updateTableAsArray(&src->asTable(), &dest->asTable(), destHandle, translateRef, outChanges, invokeHandler);
+		std::vector<size_t> changedIndices;
+		if (dest->asTable().assignDense(src->asTable(), changedIndices)) {
+			// Dense Tables with identical entry names and classes only differ in their values.
+			if (outChanges && destHandle) {
+				for (auto index : changedIndices) {
+					outChanges->recordValueChanged(destHandle[index]);
+				}
+			}
 		} else {
-			updateTableByName(&src->asTable(), &dest->asTable(), destHandle, translateRef, outChanges, invokeHandler);
+			bool srcIsArray = src->query<ArraySemanticAnnotation>();
+			bool destIsArray = dest->query<ArraySemanticAnnotation>();
+			assert((srcIsArray && destIsArray) || (!srcIsArray && !destIsArray));
+			if (srcIsArray) {
+				updateTableAsArray(&src->asTable(), &dest->asTable(), destHandle, translateRef, outChanges, invokeHandler);
+			} else {
+				updateTableByName(&src->asTable(), &dest->asTable(), destHandle, translateRef, outChanges, invokeHandler);
+			}
 		}
 	} else {
 		changed = dest->assign(*src);
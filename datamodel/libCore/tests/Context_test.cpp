@@ -74,7 +74,7 @@ TEST_F(ContextTest, Simple) {
 	EXPECT_EQ(vh_s.asString(), "dog");
 
 	auto changedValues = recorder.getChangedValues();
-	std::map<std::string, std::set<ValueHandle>> refChangedValues{{foo->objectID(), {vh_x, vh_b, vh_i, vh_s}}};
+	std::unordered_map<std::string, std::unordered_set<ValueHandle>> refChangedValues{{foo->objectID(), {vh_x, vh_b, vh_i, vh_s}}};
 	EXPECT_EQ(changedValues, refChangedValues);
 
 	ValueHandle vh_vec = o.get("vec");
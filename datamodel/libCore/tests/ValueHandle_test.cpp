@@ -17,6 +17,8 @@
 
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace raco::core;
 using namespace raco::user_types;
@@ -40,6 +42,15 @@ TEST(ValueHandle, std_collections_capabalbe) {
 	set.insert(valueHandle1);
 	set.insert(valueHandle2);
 	EXPECT_EQ(set.size(), 2);
+
+	std::unordered_map<ValueHandle, int> hashMap{};
+	hashMap[valueHandle1] = 1;
+	hashMap[valueHandle2] = 2;
+	EXPECT_EQ(hashMap[valueHandle1], 1);
+	EXPECT_EQ(hashMap[valueHandle2], 2);
+
+	std::unordered_set<ValueHandle> hashSet{valueHandle1, valueHandle2, ValueHandle(editorObject1)};
+	EXPECT_EQ(hashSet.size(), 2);
 }
 
 class MockTableObject : public EditorObject {
@@ -101,3 +112,72 @@ TEST(ValueHandle, ValueHandle_comparesByIndex_prepend) {
 	EXPECT_FALSE(child1BeforeAdd == child2AfterAdd);
 	EXPECT_TRUE(child1BeforeAdd == child1AfterAdd);
 }
+
+TEST(ValueHandle, property_index_paths_are_interned) {
+	auto root = PropertyIndexPath::root();
+	EXPECT_EQ(root->depth(), 0);
+	EXPECT_EQ(root->parent(), nullptr);
+
+	auto path = root->child(2)->child(0);
+	EXPECT_EQ(path, PropertyIndexPath::fromIndices({2, 0}));
+	EXPECT_NE(path, PropertyIndexPath::fromIndices({0, 2}));
+	EXPECT_EQ(path->indices(), std::vector<size_t>({2, 0}));
+	EXPECT_EQ(path->back(), 0);
+	EXPECT_EQ(path->parent(), root->child(2));
+	EXPECT_EQ(path->prefix(0), root);
+	EXPECT_EQ(path->hash(), PropertyIndexPath::fromIndices({2, 0})->hash());
+
+	EXPECT_TRUE(root->contains(path));
+	EXPECT_TRUE(root->child(2)->contains(path));
+	EXPECT_FALSE(path->contains(path));
+	EXPECT_FALSE(root->child(1)->contains(path));
+
+	EXPECT_TRUE(root->lessThan(path));
+	EXPECT_TRUE(root->child(2)->lessThan(path));
+	EXPECT_TRUE(path->lessThan(root->child(3)));
+	EXPECT_TRUE(PropertyIndexPath::fromIndices({1, 5})->lessThan(path));
+	EXPECT_FALSE(path->lessThan(path));
+	EXPECT_FALSE(path->lessThan(root->child(2)));
+}
+
+TEST(ValueHandle, property_index_paths_are_reused) {
+	auto path = PropertyIndexPath::fromIndices({7, 3, 1});
+	auto count = PropertyIndexPath::internedCount();
+
+	EXPECT_EQ(PropertyIndexPath::fromIndices({7, 3, 1}), path);
+	EXPECT_EQ(PropertyIndexPath::root()->child(7)->child(3), path->parent());
+	EXPECT_EQ(PropertyIndexPath::internedCount(), count);
+
+	PropertyIndexPath::fromIndices({7, 3, 2});
+	EXPECT_EQ(PropertyIndexPath::internedCount(), count + 1);
+}
+
+TEST(ValueHandle, handles_by_name_and_index_identical) {
+	const std::shared_ptr<Node> node{std::make_shared<Node>("node")};
+
+	ValueHandle byName{node, {"translation", "y"}};
+	ValueHandle byGet = ValueHandle(node).get("translation").get("y");
+	ValueHandle byIndex{node, std::vector<size_t>{static_cast<size_t>(node->index("translation")), 1}};
+
+	EXPECT_EQ(byName, byGet);
+	EXPECT_EQ(byName, byIndex);
+	EXPECT_EQ(std::hash<ValueHandle>()(byName), std::hash<ValueHandle>()(byGet));
+	EXPECT_EQ(byName.parent(), ValueHandle(node, {"translation"}));
+	EXPECT_TRUE(ValueHandle(node, {"translation"}).contains(byName));
+	EXPECT_FALSE(byName.contains(byName));
+	EXPECT_EQ(byName.getPropName(), "y");
+	EXPECT_EQ(byName.getPropertyNamesVector(), std::vector<std::string>({"translation", "y"}));
+	EXPECT_EQ(byName.getPropertyPath(), "node.translation.y");
+
+	ValueHandle sibling = byName;
+	sibling.nextSibling();
+	EXPECT_EQ(sibling, ValueHandle(node, {"translation", "z"}));
+	EXPECT_TRUE(byName < sibling);
+	EXPECT_TRUE(byName.parent() < byName);
+	EXPECT_FALSE(byName < byName);
+
+	// Failed name lookups produce an invalid handle.
+	ValueHandle invalid{node, {"translation", "w"}};
+	EXPECT_FALSE(invalid);
+	EXPECT_EQ(invalid, ValueHandle());
+}
@@ -14,261 +14,381 @@
 #include "BasicAnnotations.h"
 
 #include <array>
+#include <cassert>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 namespace raco::data_storage {
 
-class Vec2f : public ClassWithReflectedMembers {
+// Display name and range of a vector component.
+// Components with identical annotations share one interned instance, so a component only stores its value and a pointer.
+// Annotations that are modified are unshared first, see VecComponent::staticQuery.
+template <typename T>
+class VecComponentAnnotations {
 public:
-	static inline const TypeDescriptor typeDescription = { "Vec2f", false };
-	TypeDescriptor const& getTypeDescription() const override {
-		return typeDescription;
+	// Interned instance; never destroyed.
+	static VecComponentAnnotations* shared(const std::string& displayName, T min, T max);
+
+	VecComponentAnnotations(const std::string& displayName, T min, T max, bool isShared) : displayName_(displayName), range_(min, max), isShared_(isShared) {}
+
+	VecComponentAnnotations(const VecComponentAnnotations& other, bool isShared) : displayName_(other.displayName_), range_(other.range_), isShared_(isShared) {}
+
+	VecComponentAnnotations(const VecComponentAnnotations&) = delete;
+	VecComponentAnnotations& operator=(const VecComponentAnnotations&) = delete;
+
+	DisplayNameAnnotation displayName_;
+	RangeAnnotation<T> range_;
+	const std::vector<AnnotationBase*> annotationPtrs_{&displayName_, &range_};
+	const bool isShared_;
+};
+
+// Scalar component of the vector types.
+// Behaves like a Property<T, DisplayNameAnnotation, RangeAnnotation<T>> but keeps its annotations in a shared VecComponentAnnotations.
+template <typename T>
+class VecComponent : public Value<T> {
+public:
+	VecComponent(T value, const std::string& displayName, T min, T max) : Value<T>(value), annotations_(VecComponentAnnotations<T>::shared(displayName, min, max)) {}
+
+	VecComponent(const VecComponent& other) : Value<T>(other), annotations_(shareOrCopy(other.annotations_)) {}
+
+	~VecComponent() {
+		if (!annotations_->isShared_) {
+			delete annotations_;
+		}
+	}
+
+	virtual std::string typeName() const override {
+		return Value<T>::typeName() + "::" + DisplayNameAnnotation::typeDescription.typeName + "::" + RangeAnnotation<T>::typeDescription.typeName;
+	}
+
+	virtual std::unique_ptr<ValueBase> clone(std::function<SEditorObject(SEditorObject)>* translateRef) const override {
+		return std::make_unique<VecComponent>(*this);
+	}
+
+	VecComponent& operator=(const VecComponent& other) {
+		Value<T>::operator=(other);
+		return *this;
+	}
+
+	void operator=(T const& newValue) {
+		Value<T>::operator=(newValue);
+	}
+
+	virtual void copyAnnotationData(const ValueBase& src) override {
+		const VecComponent* src_p = dynamic_cast<const VecComponent*>(&src);
+		if (!src_p) {
+			throw std::runtime_error("type mismatch");
+		}
+		if (src_p->annotations_ != annotations_) {
+			setAnnotations(shareOrCopy(src_p->annotations_));
+		}
+	}
+
+	// Returns an annotation for modification; the annotations of this component are unshared first.
+	template <class Anno>
+	Anno& staticQuery() {
+		unshareAnnotations();
+		if constexpr (std::is_same<Anno, DisplayNameAnnotation>::value) {
+			return annotations_->displayName_;
+		} else {
+			static_assert(std::is_same<Anno, RangeAnnotation<T>>::value, "Vector components only have display name and range annotations");
+			return annotations_->range_;
+		}
+	}
+
+	const std::vector<AnnotationBase*>& baseAnnotationPtrs() const override {
+		return annotations_->annotationPtrs_;
 	}
+
+	const std::vector<AnnotationBase*>& modifiableAnnotationPtrs() override {
+		unshareAnnotations();
+		return annotations_->annotationPtrs_;
+	}
+
+	void annotationsModified() override {
+		if (!annotations_->isShared_) {
+			setAnnotations(VecComponentAnnotations<T>::shared(*annotations_->displayName_.name_, *annotations_->range_.min_, *annotations_->range_.max_));
+		}
+	}
+
+private:
+	static VecComponentAnnotations<T>* shareOrCopy(VecComponentAnnotations<T>* annotations) {
+		return annotations->isShared_ ? annotations : new VecComponentAnnotations<T>(*annotations, false);
+	}
+
+	void setAnnotations(VecComponentAnnotations<T>* annotations) {
+		if (!annotations_->isShared_) {
+			delete annotations_;
+		}
+		annotations_ = annotations;
+	}
+
+	void unshareAnnotations() {
+		if (annotations_->isShared_) {
+			annotations_ = new VecComponentAnnotations<T>(*annotations_, false);
+		}
+	}
+
+	VecComponentAnnotations<T>* annotations_;
+};
+
+// Common reflection interface of the vector types.
+// The components are plain members of the derived class listed in its static `components` array. Their names are
+// described by a schema shared by all vectors of the same type, so vectors need no per-instance property list.
+template <class Vec, typename T, size_t N>
+class VecBase : public ClassWithReflectedMembers {
+public:
+	using Component = VecComponent<T>;
+
 	bool serializationRequired() const override {
 		return true;
 	}
-	Vec2f(const Vec2f& other, std::function<SEditorObject(SEditorObject)>* translateRef = nullptr) : ClassWithReflectedMembers(getProperties()), x(other.x), y(other.y) {}
+
+	ValueBase* get(std::string const& propertyName) override {
+		int index = schema().index(propertyName);
+		return index >= 0 ? &component(index) : nullptr;
+	}
+
+	ValueBase* get(size_t index) override {
+		return index < N ? &component(index) : nullptr;
+	}
+
+	const ValueBase* get(std::string const& propertyName) const override {
+		int index = schema().index(propertyName);
+		return index >= 0 ? &component(index) : nullptr;
+	}
+
+	const ValueBase* get(size_t index) const override {
+		return index < N ? &component(index) : nullptr;
+	}
+
+	size_t size() const override {
+		return N;
+	}
+
+	int index(std::string const& propertyName) const override {
+		return schema().index(propertyName);
+	}
+
+	std::string name(size_t index) const override {
+		assert(index < N);
+		return schema().name(index);
+	}
+
+	const PropertySchema& propertySchema() const override {
+		return schema();
+	}
+
+	void copyAnnotationData(const Vec& other) {
+		for (size_t index = 0; index < N; index++) {
+			component(index).copyAnnotationData(other.component(index));
+		}
+	}
+
+protected:
+	void assign(const Vec& other) {
+		for (size_t index = 0; index < N; index++) {
+			component(index) = other.component(index);
+		}
+	}
+
+private:
+	static const PropertySchema& schema() {
+		static const PropertySchema* schema = []() {
+			auto schema = PropertySchema::empty();
+			for (auto name : Vec::componentNames) {
+				schema = schema->extend(name);
+			}
+			return schema;
+		}();
+		return *schema;
+	}
+
+	Component& component(size_t index) {
+		return static_cast<Vec*>(this)->*Vec::components[index];
+	}
+
+	const Component& component(size_t index) const {
+		return static_cast<const Vec*>(this)->*Vec::components[index];
+	}
+};
+
+class Vec2f : public VecBase<Vec2f, double, 2> {
+public:
+	static inline const TypeDescriptor typeDescription = { "Vec2f", false };
+	TypeDescriptor const& getTypeDescription() const override {
+		return typeDescription;
+	}
+	Vec2f(const Vec2f& other, std::function<SEditorObject(SEditorObject)>* translateRef = nullptr) : x(other.x), y(other.y) {}
 
 	Vec2f(double defaultValue = 0.0, double step = 0.1, double min = 0.0, double max = 1.0) :
-		ClassWithReflectedMembers(getProperties()),
-		x{ defaultValue, DisplayNameAnnotation{ "X" }, RangeAnnotation<double>(min, max) },
-		y{ defaultValue, DisplayNameAnnotation{ "Y" }, RangeAnnotation<double>(min, max) }
+		x{ defaultValue, "X", min, max },
+		y{ defaultValue, "Y", min, max }
 	{}
 
 	Vec2f& operator=(const Vec2f& other) {
-		x = other.x;
-		y = other.y;
+		assign(other);
 		return *this;
 	}
-	
-	void copyAnnotationData(const Vec2f& other) {
-		x.copyAnnotationData(other.x);
-		y.copyAnnotationData(other.y);
-	}
 
-	std::vector<std::pair<std::string, ValueBase*>> getProperties() {
-		return { {"x", &x}, {"y", &y} };
-	}
+	Component x;
+	Component y;
 
-public:
-	Property<double, DisplayNameAnnotation, RangeAnnotation<double>> x;
-	Property<double, DisplayNameAnnotation, RangeAnnotation<double>> y;
+	static constexpr std::array<const char*, 2> componentNames{"x", "y"};
+	static constexpr std::array<Component Vec2f::*, 2> components{&Vec2f::x, &Vec2f::y};
 };
 
 
-class Vec3f : public ClassWithReflectedMembers {
+class Vec3f : public VecBase<Vec3f, double, 3> {
 public:
 	static inline const TypeDescriptor typeDescription = { "Vec3f", false };
 	TypeDescriptor const& getTypeDescription() const override {
 		return typeDescription;
 	}
-	bool serializationRequired() const override {
-		return true;
-	}
-	Vec3f(const Vec3f& other, std::function<SEditorObject(SEditorObject)>* translateRef = nullptr) : ClassWithReflectedMembers(getProperties()), x(other.x), y(other.y), z(other.z) {}
+	Vec3f(const Vec3f& other, std::function<SEditorObject(SEditorObject)>* translateRef = nullptr) : x(other.x), y(other.y), z(other.z) {}
 
 	Vec3f(double defaultValue = 0.0, double step = 0.1, double min = 0.0, double max = 1.0) :
-		ClassWithReflectedMembers(getProperties()),
-		x{ defaultValue, DisplayNameAnnotation{ "X" }, RangeAnnotation<double>(min, max) },
-		y{ defaultValue, DisplayNameAnnotation{ "Y" }, RangeAnnotation<double>(min, max) },
-		z{ defaultValue, DisplayNameAnnotation{ "Z" }, RangeAnnotation<double>(min, max) }
+		x{ defaultValue, "X", min, max },
+		y{ defaultValue, "Y", min, max },
+		z{ defaultValue, "Z", min, max }
 	{}
 
 	Vec3f& operator=(const Vec3f& other) {
-		x = other.x;
-		y = other.y;
-		z = other.z;
+		assign(other);
 		return *this;
 	}
-	
-	void copyAnnotationData(const Vec3f& other) {
-		x.copyAnnotationData(other.x);
-		y.copyAnnotationData(other.y);
-		z.copyAnnotationData(other.z);
-	}
 
-	std::vector<std::pair<std::string, ValueBase*>> getProperties() {
-		return { {"x", &x}, {"y", &y}, {"z", &z} };
-	}
+	Component x;
+	Component y;
+	Component z;
 
-public:
-	Property<double, DisplayNameAnnotation, RangeAnnotation<double>> x;
-	Property<double, DisplayNameAnnotation, RangeAnnotation<double>> y;
-	Property<double, DisplayNameAnnotation, RangeAnnotation<double>> z;
+	static constexpr std::array<const char*, 3> componentNames{"x", "y", "z"};
+	static constexpr std::array<Component Vec3f::*, 3> components{&Vec3f::x, &Vec3f::y, &Vec3f::z};
 };
 
 
-class Vec4f : public ClassWithReflectedMembers {
+class Vec4f : public VecBase<Vec4f, double, 4> {
 public:
 	static inline const TypeDescriptor typeDescription = { "Vec4f", false };
 	TypeDescriptor const& getTypeDescription() const override {
 		return typeDescription;
 	}
-	bool serializationRequired() const override {
-		return true;
-	}
-	Vec4f(const Vec4f& other, std::function<SEditorObject(SEditorObject)>* translateRef = nullptr) : ClassWithReflectedMembers(getProperties()), x(other.x), y(other.y), z(other.z), w(other.w) {}
+	Vec4f(const Vec4f& other, std::function<SEditorObject(SEditorObject)>* translateRef = nullptr) : x(other.x), y(other.y), z(other.z), w(other.w) {}
 
 	Vec4f(double defaultValue = 0.0, double step = 0.1, double min = 0.0, double max = 1.0) :
-		ClassWithReflectedMembers(getProperties()),
-		x{ defaultValue, DisplayNameAnnotation{ "X" }, RangeAnnotation<double>(min, max) },
-		y{ defaultValue, DisplayNameAnnotation{ "Y" }, RangeAnnotation<double>(min, max) },
-		z{ defaultValue, DisplayNameAnnotation{ "Z" }, RangeAnnotation<double>(min, max) },
-		w{ defaultValue, DisplayNameAnnotation{ "W" }, RangeAnnotation<double>(min, max) }
+		x{ defaultValue, "X", min, max },
+		y{ defaultValue, "Y", min, max },
+		z{ defaultValue, "Z", min, max },
+		w{ defaultValue, "W", min, max }
 	{}
 
 	Vec4f& operator=(const Vec4f& other) {
-		x = other.x;
-		y = other.y;
-		z = other.z;
-		w = other.w;
+		assign(other);
 		return *this;
 	}
 
-	void copyAnnotationData(const Vec4f& other) {
-		x.copyAnnotationData(other.x);
-		y.copyAnnotationData(other.y);
-		z.copyAnnotationData(other.z);
-		w.copyAnnotationData(other.w);
-	}
-	
-	std::vector<std::pair<std::string, ValueBase*>> getProperties() {
-		return { {"x", &x}, {"y", &y}, {"z", &z}, {"w", &w } };
-	}
+	Component x;
+	Component y;
+	Component z;
+	Component w;
 
-	Property<double, DisplayNameAnnotation, RangeAnnotation<double>> x;
-	Property<double, DisplayNameAnnotation, RangeAnnotation<double>> y;
-	Property<double, DisplayNameAnnotation, RangeAnnotation<double>> z;
-	Property<double, DisplayNameAnnotation, RangeAnnotation<double>> w;
+	static constexpr std::array<const char*, 4> componentNames{"x", "y", "z", "w"};
+	static constexpr std::array<Component Vec4f::*, 4> components{&Vec4f::x, &Vec4f::y, &Vec4f::z, &Vec4f::w};
 };
 
 
-class Vec2i : public ClassWithReflectedMembers {
+class Vec2i : public VecBase<Vec2i, int, 2> {
 public:
 	static inline const TypeDescriptor typeDescription = { "Vec2i", false };
 	TypeDescriptor const& getTypeDescription() const override {
 		return typeDescription;
 	}
-	bool serializationRequired() const override {
-		return true;
-	}
-	Vec2i(const Vec2i& other, std::function<SEditorObject(SEditorObject)>* translateRef = nullptr) : ClassWithReflectedMembers(getProperties()), i1_(other.i1_), i2_(other.i2_) {}
+	Vec2i(const Vec2i& other, std::function<SEditorObject(SEditorObject)>* translateRef = nullptr) : i1_(other.i1_), i2_(other.i2_) {}
 
 	Vec2i(int defaultValue = 0, int step = 1, int min = 0, int max = 1) :
-		ClassWithReflectedMembers(getProperties()),
-		i1_{ defaultValue, DisplayNameAnnotation{ "i1" }, RangeAnnotation<int>(min, max) },
-		i2_{ defaultValue, DisplayNameAnnotation{ "i2" }, RangeAnnotation<int>(min, max) }
+		i1_{ defaultValue, "i1", min, max },
+		i2_{ defaultValue, "i2", min, max }
 	{}
 
-    Vec2i(std::array<int, 2> values, int min, int max) : ClassWithReflectedMembers(getProperties()),
-														i1_{values[0], DisplayNameAnnotation{"i1"}, RangeAnnotation<int>(min, max)},
-														i2_{values[1], DisplayNameAnnotation{"i2"}, RangeAnnotation<int>(min, max)} {}
+	Vec2i(std::array<int, 2> values, int min, int max) :
+		i1_{ values[0], "i1", min, max },
+		i2_{ values[1], "i2", min, max }
+	{}
 
 	Vec2i& operator=(const Vec2i& other) {
-		i1_ = other.i1_;
-		i2_ = other.i2_;
+		assign(other);
 		return *this;
 	}
 
-	void copyAnnotationData(const Vec2i& other) {
-		i1_.copyAnnotationData(other.i1_);
-		i2_.copyAnnotationData(other.i2_);
-	}
-
-	std::vector<std::pair<std::string, ValueBase*>> getProperties() {
-		return { {"i1", &i1_}, {"i2", &i2_} };
-	}
+	Component i1_;
+	Component i2_;
 
-	Property<int, DisplayNameAnnotation, RangeAnnotation<int>> i1_;
-	Property<int, DisplayNameAnnotation, RangeAnnotation<int>> i2_;
+	static constexpr std::array<const char*, 2> componentNames{"i1", "i2"};
+	static constexpr std::array<Component Vec2i::*, 2> components{&Vec2i::i1_, &Vec2i::i2_};
 };
 
-class Vec3i : public ClassWithReflectedMembers {
+class Vec3i : public VecBase<Vec3i, int, 3> {
 public:
 	static inline const TypeDescriptor typeDescription = { "Vec3i", false };
 	TypeDescriptor const& getTypeDescription() const override {
 		return typeDescription;
 	}
-	bool serializationRequired() const override {
-		return true;
-	}
-	Vec3i(const Vec3i& other, std::function<SEditorObject(SEditorObject)>* translateRef = nullptr) : ClassWithReflectedMembers(getProperties()), i1_(other.i1_), i2_(other.i2_), i3_(other.i3_) {}
+	Vec3i(const Vec3i& other, std::function<SEditorObject(SEditorObject)>* translateRef = nullptr) : i1_(other.i1_), i2_(other.i2_), i3_(other.i3_) {}
 
 	Vec3i(int defaultValue = 0, int step = 1, int min = 0, int max = 1) :
-		ClassWithReflectedMembers(getProperties()),
-		i1_{ defaultValue, DisplayNameAnnotation{ "i1" }, RangeAnnotation<int>(min, max) },
-		i2_{ defaultValue, DisplayNameAnnotation{ "i2" }, RangeAnnotation<int>(min, max) },
-		i3_{ defaultValue, DisplayNameAnnotation{ "i3" }, RangeAnnotation<int>(min, max) }
+		i1_{ defaultValue, "i1", min, max },
+		i2_{ defaultValue, "i2", min, max },
+		i3_{ defaultValue, "i3", min, max }
 	{}
 
 	Vec3i& operator=(const Vec3i& other) {
-		i1_ = other.i1_;
-		i2_ = other.i2_;
-		i3_ = other.i3_;
+		assign(other);
 		return *this;
 	}
 
-	void copyAnnotationData(const Vec3i& other) {
-		i1_.copyAnnotationData(other.i1_);
-		i2_.copyAnnotationData(other.i2_);
-		i3_.copyAnnotationData(other.i3_);
-	}
+	Component i1_;
+	Component i2_;
+	Component i3_;
 
-	std::vector<std::pair<std::string, ValueBase*>> getProperties() {
-		return { {"i1", &i1_}, {"i2", &i2_}, {"i3", &i3_} };
-	}
-	Property<int, DisplayNameAnnotation, RangeAnnotation<int>> i1_;
-	Property<int, DisplayNameAnnotation, RangeAnnotation<int>> i2_;
-	Property<int, DisplayNameAnnotation, RangeAnnotation<int>> i3_;
+	static constexpr std::array<const char*, 3> componentNames{"i1", "i2", "i3"};
+	static constexpr std::array<Component Vec3i::*, 3> components{&Vec3i::i1_, &Vec3i::i2_, &Vec3i::i3_};
 };
 
-class Vec4i : public ClassWithReflectedMembers {
+class Vec4i : public VecBase<Vec4i, int, 4> {
 public:
 	static inline const TypeDescriptor typeDescription = { "Vec4i", false };
 	TypeDescriptor const& getTypeDescription() const override {
 		return typeDescription;
 	}
-	bool serializationRequired() const override {
-		return true;
-	}
-	Vec4i(const Vec4i& other, std::function<SEditorObject(SEditorObject)>* translateRef = nullptr) : ClassWithReflectedMembers(getProperties()), i1_(other.i1_), i2_(other.i2_), i3_(other.i3_), i4_(other.i4_) {}
+	Vec4i(const Vec4i& other, std::function<SEditorObject(SEditorObject)>* translateRef = nullptr) : i1_(other.i1_), i2_(other.i2_), i3_(other.i3_), i4_(other.i4_) {}
 
 	Vec4i(int defaultValue = 0, int step = 1, int min = 0, int max = 1) :
-		ClassWithReflectedMembers(getProperties()),
-		i1_{ defaultValue, DisplayNameAnnotation{ "i1" }, RangeAnnotation<int>(min, max) },
-		i2_{ defaultValue, DisplayNameAnnotation{ "i2" }, RangeAnnotation<int>(min, max) },
-		i3_{ defaultValue, DisplayNameAnnotation{ "i3" }, RangeAnnotation<int>(min, max) },
-		i4_{ defaultValue, DisplayNameAnnotation{ "i4" }, RangeAnnotation<int>(min, max) }
+		i1_{ defaultValue, "i1", min, max },
+		i2_{ defaultValue, "i2", min, max },
+		i3_{ defaultValue, "i3", min, max },
+		i4_{ defaultValue, "i4", min, max }
 	{}
 
-	Vec4i(std::array<int, 4> values, int min, int max) : ClassWithReflectedMembers(getProperties()),
-																	i1_{values[0], DisplayNameAnnotation{"i1"}, RangeAnnotation<int>(min, max)},
-																	i2_{values[1], DisplayNameAnnotation{"i2"}, RangeAnnotation<int>(min, max)},
-																	i3_{values[2], DisplayNameAnnotation{"i3"}, RangeAnnotation<int>(min, max)},
-																	i4_{values[3], DisplayNameAnnotation{"i4"}, RangeAnnotation<int>(min, max)} {}
+	Vec4i(std::array<int, 4> values, int min, int max) :
+		i1_{ values[0], "i1", min, max },
+		i2_{ values[1], "i2", min, max },
+		i3_{ values[2], "i3", min, max },
+		i4_{ values[3], "i4", min, max }
+	{}
 
 	Vec4i& operator=(const Vec4i& other) {
-		i1_ = other.i1_;
-		i2_ = other.i2_;
-		i3_ = other.i3_;
-		i4_ = other.i4_;
+		assign(other);
 		return *this;
 	}
-	
-	void copyAnnotationData(const Vec4i& other) {
-		i1_.copyAnnotationData(other.i1_);
-		i2_.copyAnnotationData(other.i2_);
-		i3_.copyAnnotationData(other.i3_);
-		i4_.copyAnnotationData(other.i4_);
-	}
 
-	std::vector<std::pair<std::string, ValueBase*>> getProperties() {
-		return { {"i1", &i1_}, {"i2", &i2_}, {"i3", &i3_}, {"i4", &i4_} };
-	}
+	Component i1_;
+	Component i2_;
+	Component i3_;
+	Component i4_;
 
-	Property<int, DisplayNameAnnotation, RangeAnnotation<int>> i1_;
-	Property<int, DisplayNameAnnotation, RangeAnnotation<int>> i2_;
-	Property<int, DisplayNameAnnotation, RangeAnnotation<int>> i3_;
-	Property<int, DisplayNameAnnotation, RangeAnnotation<int>> i4_;
+	static constexpr std::array<const char*, 4> componentNames{"i1", "i2", "i3", "i4"};
+	static constexpr std::array<Component Vec4i::*, 4> components{&Vec4i::i1_, &Vec4i::i2_, &Vec4i::i3_, &Vec4i::i4_};
 };
 
-}
\ No newline at end of file
+}
@@ -9,9 +9,13 @@
  */
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace raco::data_storage {
@@ -72,6 +76,79 @@ public:
 	bool operator==(const ReflectionInterface& other) const;
 };
 
+// Immutable list of property names shared by all objects with the same sequence of reflected properties.
+// Schemas are interned: extending a schema by a name always yields the same schema object, so all instances
+// of a class end up with the same schema no matter in which constructor the properties are registered.
+class PropertySchema {
+public:
+	PropertySchema(const PropertySchema&) = delete;
+	PropertySchema& operator=(const PropertySchema&) = delete;
+
+	// Schema without any properties.
+	static const PropertySchema* empty();
+
+	// Schema with all properties of this schema followed by the given property.
+	// Lock-free if the extension exists already, which is the case for all but the first instance of a class.
+	const PropertySchema* extend(std::string_view name) const;
+
+	size_t size() const {
+		return names_.size();
+	}
+
+	const std::string& name(size_t index) const {
+		return *names_[index];
+	}
+
+	// Find index from property name; return -1 if not found
+	int index(std::string_view name) const;
+
+private:
+	PropertySchema() = default;
+
+	// Names of all properties; the strings are owned by the schema introducing them.
+	std::vector<const std::string*> names_;
+	std::string ownName_;
+
+	// Lookup table for larger schemas, built on first use.
+	mutable std::once_flag lookupBuilt_;
+	mutable std::unordered_map<std::string_view, int> lookup_;
+
+	// Extensions of this schema by one more property as a list which is only ever prepended to.
+	// Readers walk the list without locking; insertions are serialized by the global schema mutex.
+	mutable std::atomic<const PropertySchema*> firstExtension_{nullptr};
+	const PropertySchema* nextSibling_{nullptr};
+	// Owns the extensions, guarded by the global schema mutex.
+	mutable std::vector<std::unique_ptr<PropertySchema>> extensions_;
+};
+
+// Reflected properties of a ClassWithReflectedMembers: the shared schema and the value pointers of the instance.
+class ReflectedProperties {
+public:
+	ReflectedProperties() = default;
+	ReflectedProperties(std::vector<std::pair<std::string, ValueBase*>>&& properties);
+
+	void emplace_back(std::string_view name, ValueBase* value) {
+		schema_ = schema_->extend(name);
+		values_.emplace_back(value);
+	}
+
+	size_t size() const {
+		return values_.size();
+	}
+
+	const PropertySchema& schema() const {
+		return *schema_;
+	}
+
+	ValueBase* value(size_t index) const {
+		return values_[index];
+	}
+
+private:
+	const PropertySchema* schema_{PropertySchema::empty()};
+	std::vector<ValueBase*> values_;
+};
+
 class ClassWithReflectedMembers : public ReflectionInterface {
 public:
 	ClassWithReflectedMembers(const ClassWithReflectedMembers &) = delete;
@@ -93,6 +170,11 @@ public:
 	virtual int index(std::string const& propertyName) const override;
 	virtual std::string name(size_t index) const override;
 
+	// Property names, shared with all other objects of the same class.
+	virtual const PropertySchema& propertySchema() const {
+		return properties_.schema();
+	}
+
 	
 	template <class Anno>
 	std::shared_ptr<Anno> query() const {
@@ -119,7 +201,7 @@ public:
 	const std::vector<std::shared_ptr<AnnotationBase>>& annotations() const;
 
 protected:
-	std::vector<std::pair<std::string, ValueBase*>> properties_;
+	ReflectedProperties properties_;
 
 	std::vector<std::shared_ptr<AnnotationBase>> annotations_;
 };
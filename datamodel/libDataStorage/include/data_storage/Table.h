@@ -19,6 +19,16 @@
 namespace raco::data_storage {
 
 // Dictionary with annotations
+//
+// Copies of a Table share their entries until one of them is accessed through a non-const member function,
+// which gives that Table its own copy of the entries first. Copying a Table is therefore cheap, but a ValueBase
+// pointer obtained from a non-const Table must not be used to modify it anymore once the Table has been copied.
+//
+// Dense Tables store Int or Double entries of a single class with identical annotation data, e.g. the elements
+// of Lua array properties, in one contiguous array. Their entries are views into that array sharing the annotations
+// of a prototype Value. Adding an entry of a different class or with other annotation data turns a dense Table
+// back into a Table with separately allocated entries. Adding, removing or replacing entries of a dense Table
+// invalidates all pointers to its entries.
 class Table : public ReflectionInterface {
 public:
 	static inline const TypeDescriptor typeDescription = { "Table", false };
@@ -30,7 +40,8 @@ public:
 	}
 	Table() = default;
 
-	// Performs deep copy of all property values of the argument
+	// Copy of all property values of the argument; the entries are shared with the argument until either Table is modified.
+	// References are translated eagerly, but only entries containing references are copied for that.
 	Table(const Table&, std::function<SEditorObject(SEditorObject)>* translateRef = nullptr);
 
 	virtual ValueBase* get(std::string const& propertyName) override;
@@ -47,6 +58,24 @@ public:
 
 	std::vector<std::string> propertyNames() const;
 
+	// Check if the Table contains a PrimitiveType::Ref value, either directly or in nested Tables.
+	bool containsReferences() const;
+
+	// Store the entries contiguously if possible, see above; returns true if the Table is dense afterwards.
+	bool makeDense();
+	bool isDense() const;
+
+	// The contiguous values of a dense Table with entries of type T (int or double), nullptr otherwise.
+	template <typename T>
+	const T* denseData() const;
+	template <typename T>
+	T* denseData();
+
+	// Take over the values and annotation data of a dense Table with the same entry names and classes.
+	// Returns false and leaves the Table unchanged if either Table is not dense or their layouts differ;
+	// otherwise changedIndices is set to the indices of the entries whose values changed.
+	bool assignDense(const Table& source, std::vector<size_t>& changedIndices);
+
 	// array and dictionary interface
 	// can add and remove array entries / named properties
 
@@ -96,7 +125,16 @@ public:
 	bool compare(std::vector<T> const& array) const;
 
 private:
-	std::vector<std::pair<std::string, std::unique_ptr<ValueBase>>> properties_;
+	using Entries = std::vector<std::pair<std::string, std::unique_ptr<ValueBase>>>;
+	struct Payload;
+
+	// Make the payload exclusive to this Table before it can be modified.
+	Payload& mutablePayload();
+	// Exclusive payload with separately allocated entries.
+	Entries& mutableEntries();
+
+	// Empty Tables don't have a payload.
+	std::shared_ptr<Payload> payload_;
 };
 
 }
\ No newline at end of file
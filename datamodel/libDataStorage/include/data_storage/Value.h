@@ -9,6 +9,8 @@
  */
 #pragma once
 
+#include "ValueAllocator.h"
+
 #include <memory>
 #include <stdexcept>
 #include <tuple>
@@ -143,7 +145,7 @@ using TypeMapType = std::tuple<bool, int, double, std::string, SEditorObject, Ta
 // - they are type safe: operations will enforce identical classes at runtime if
 //   multiple PrimitiveType::Struct Values are involved.
 // - for a Value<CC> to be usable the class CC must be derived from ClassWithReflectedMembers
-// - CC must implement the following member functions (same as for e.g. Vec2f)
+// - CC must implement the following member functions
 //   CC(const CC& other, std::function<SEditorObject(SEditorObject)>* translateRef)
 //   CC& operator=(const CC& other) 
 //   copyAnnotationData(const CC& other) 
@@ -153,6 +155,16 @@ using TypeMapType = std::tuple<bool, int, double, std::string, SEditorObject, Ta
 
 class ValueBase {
 public:
+	virtual ~ValueBase() = default;
+
+	// Heap allocated Values, e.g. Table entries, are taken from the ValueAllocator slabs.
+	static void* operator new(size_t size) {
+		return ValueAllocator::allocate(size);
+	}
+	static void operator delete(void* pointer, size_t size) noexcept {
+		ValueAllocator::deallocate(pointer, size);
+	}
+
 	static std::unique_ptr<ValueBase> create(PrimitiveType type);
 
 	virtual PrimitiveType type() const = 0;
@@ -220,8 +232,14 @@ public:
 	// - Value<T> differs from Property<T>
 	// - Property<T, ...> with different annotations classes differ
 	// - different SEditorClass subclasses used as type in Value or Property differ
+	// - the entries of dense Tables differ from Property<T, ...> and equal each other only if their prototypes do
 	static bool classesEqual(const ValueBase& left, const ValueBase& right); 
 
+	// Value whose class this Value stands in for in classesEqual; the prototype of the entries of dense Tables.
+	virtual const ValueBase& classPrototype() const {
+		return *this;
+	}
+
 	// The assignment operator doesn't copy the annotation data; see notes above
 	virtual ValueBase& operator=(const ValueBase&) = 0;
 
@@ -268,6 +286,16 @@ public:
 		static std::vector<AnnotationBase*> noAnnotations;
 		return noAnnotations;
 	}
+
+	// Annotations for modification, e.g. by deserialization.
+	// Values sharing their annotations with other values (the components of the Vec2f,... types) get a private copy first;
+	// call annotationsModified() when done to share them again if possible.
+	virtual const std::vector<AnnotationBase*>& modifiableAnnotationPtrs() {
+		return baseAnnotationPtrs();
+	}
+
+	virtual void annotationsModified() {
+	}
 };
 
 template <>
@@ -0,0 +1,46 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include <cstddef>
+
+namespace raco::data_storage {
+
+// Slab allocator for the heap allocated Values, i.e. Table entries and cloned or dynamically created properties.
+// Small objects are served from free lists per size class which are carved out of large slabs, so creating and
+// destroying objects with many dynamic properties needs only a few calls to the general purpose allocator.
+// Slabs are kept for reuse and never returned to the system.
+class ValueAllocator {
+public:
+	// Objects larger than this are forwarded to the global operator new.
+	static constexpr size_t MAX_SLAB_OBJECT_SIZE = 512;
+	static constexpr size_t SLAB_SIZE = 64 * 1024;
+
+	struct Statistics {
+		// Number of allocate and deallocate calls since program start.
+		size_t allocations;
+		size_t deallocations;
+		// Number of allocations forwarded to the global operator new.
+		size_t largeAllocations;
+		size_t slabs;
+		size_t slabBytes;
+
+		size_t liveObjects() const {
+			return allocations - deallocations;
+		}
+	};
+
+	static void* allocate(size_t size);
+	static void deallocate(void* pointer, size_t size) noexcept;
+
+	static Statistics statistics();
+};
+
+}  // namespace raco::data_storage
@@ -0,0 +1,35 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "data_storage/BasicTypes.h"
+
+#include <map>
+#include <mutex>
+#include <tuple>
+
+namespace raco::data_storage {
+
+template <typename T>
+VecComponentAnnotations<T>* VecComponentAnnotations<T>::shared(const std::string& displayName, T min, T max) {
+	static std::mutex mutex;
+	// Never destroyed, since objects with static storage duration may still use the shared annotations on exit.
+	static auto instances = new std::map<std::tuple<std::string, T, T>, std::unique_ptr<VecComponentAnnotations>>();
+
+	std::lock_guard<std::mutex> lock(mutex);
+	auto& instance = (*instances)[{displayName, min, max}];
+	if (!instance) {
+		instance = std::make_unique<VecComponentAnnotations>(displayName, min, max, true);
+	}
+	return instance.get();
+}
+
+template class VecComponentAnnotations<double>;
+template class VecComponentAnnotations<int>;
+
+}  // namespace raco::data_storage
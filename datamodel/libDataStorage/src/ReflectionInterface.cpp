@@ -29,38 +29,101 @@ ValueBase* ReflectionInterface::operator[](size_t index)
 
 
 
-ValueBase* ClassWithReflectedMembers::get(std::string const& propertyName) {
-	auto it = std::find_if(properties_.begin(), properties_.end(),
-		[&propertyName](auto const& item) {
-			return item.first == propertyName;
-		});
-	if (it != properties_.end()) {
-		return it->second;
+namespace {
+
+// Below this size, comparing all names is at least as fast as hashing the looked up name.
+constexpr size_t MIN_SCHEMA_SIZE_FOR_LOOKUP_TABLE = 8;
+
+std::mutex& schemaMutex() {
+	static std::mutex mutex;
+	return mutex;
+}
+
+}  // namespace
+
+const PropertySchema* PropertySchema::empty() {
+	// Never destroyed, since objects with static storage duration may still use their schemas on exit.
+	static const PropertySchema* emptySchema = new PropertySchema();
+	return emptySchema;
+}
+
+const PropertySchema* PropertySchema::extend(std::string_view name) const {
+	auto findExtension = [this, name](const PropertySchema* first) -> const PropertySchema* {
+		for (auto extension = first; extension; extension = extension->nextSibling_) {
+			if (extension->ownName_ == name) {
+				return extension;
+			}
+		}
+		return nullptr;
+	};
+
+	auto first = firstExtension_.load(std::memory_order_acquire);
+	if (auto extension = findExtension(first)) {
+		return extension;
+	}
+
+	std::lock_guard<std::mutex> lock(schemaMutex());
+	// Another thread may have added the extension in the meantime.
+	first = firstExtension_.load(std::memory_order_relaxed);
+	if (auto extension = findExtension(first)) {
+		return extension;
+	}
+	std::unique_ptr<PropertySchema> extension(new PropertySchema());
+	extension->ownName_ = name;
+	extension->names_ = names_;
+	extension->names_.emplace_back(&extension->ownName_);
+	extension->nextSibling_ = first;
+	firstExtension_.store(extension.get(), std::memory_order_release);
+	return extensions_.emplace_back(std::move(extension)).get();
+}
+
+int PropertySchema::index(std::string_view name) const {
+	if (names_.size() < MIN_SCHEMA_SIZE_FOR_LOOKUP_TABLE) {
+		for (size_t index = 0; index < names_.size(); index++) {
+			if (*names_[index] == name) {
+				return static_cast<int>(index);
+			}
+		}
+		return -1;
+	}
+	std::call_once(lookupBuilt_, [this]() {
+		lookup_.reserve(names_.size());
+		for (size_t index = 0; index < names_.size(); index++) {
+			// Keep the first property if names are duplicated, like a linear search would.
+			lookup_.emplace(*names_[index], static_cast<int>(index));
+		}
+	});
+	auto it = lookup_.find(name);
+	return it != lookup_.end() ? it->second : -1;
+}
+
+ReflectedProperties::ReflectedProperties(std::vector<std::pair<std::string, ValueBase*>>&& properties) {
+	values_.reserve(properties.size());
+	for (const auto& [name, value] : properties) {
+		emplace_back(name, value);
 	}
-	return nullptr;
+}
+
+ValueBase* ClassWithReflectedMembers::get(std::string const& propertyName) {
+	int index = properties_.schema().index(propertyName);
+	return index >= 0 ? properties_.value(index) : nullptr;
 }
 
 ValueBase* ClassWithReflectedMembers::get(size_t index) {
 	if (index < properties_.size()) {
-		return properties_[index].second;
+		return properties_.value(index);
 	}
 	return nullptr;
 }
 
 const ValueBase* ClassWithReflectedMembers::get(std::string const& propertyName) const {
-	auto it = std::find_if(properties_.begin(), properties_.end(),
-		[&propertyName](auto const& item) {
-			return item.first == propertyName;
-		});
-	if (it != properties_.end()) {
-		return it->second;
-	}
-	return nullptr;
+	int index = properties_.schema().index(propertyName);
+	return index >= 0 ? properties_.value(index) : nullptr;
 }
 
 const ValueBase* ClassWithReflectedMembers::get(size_t index) const {
 	if (index < properties_.size()) {
-		return properties_[index].second;
+		return properties_.value(index);
 	}
 	return nullptr;
 }
@@ -70,19 +133,12 @@ size_t ClassWithReflectedMembers::size() const {
 }
 
 int ClassWithReflectedMembers::index(std::string const& propertyName) const {
-	auto it = std::find_if(properties_.begin(), properties_.end(),
-		[&propertyName](auto const& item) {
-			return item.first == propertyName;
-		});
-	if (it != properties_.end()) {
-		return static_cast<int>(it - properties_.begin());
-	}
-	return -1;
+	return properties_.schema().index(propertyName);
 }
 
 std::string ClassWithReflectedMembers::name(size_t index) const {
 	assert(index < properties_.size());
-	return properties_[index].first;
+	return properties_.schema().name(index);
 }
 
 bool ReflectionInterface::hasProperty(std::string const& propertyName) const {
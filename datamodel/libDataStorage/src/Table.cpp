@@ -8,73 +8,515 @@
  * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 #include "data_storage/Table.h"
+#include "data_storage/AnnotationBase.h"
 #include "data_storage/Value.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <tuple>
+#include <typeinfo>
+#include <utility>
 
 namespace raco::data_storage {
 
+namespace {
+
+bool annotationsEqual(const ValueBase& left, const ValueBase& right) {
+	auto const& leftAnnotations = left.baseAnnotationPtrs();
+	auto const& rightAnnotations = right.baseAnnotationPtrs();
+	return std::equal(leftAnnotations.begin(), leftAnnotations.end(), rightAnnotations.begin(), rightAnnotations.end(),
+		[](const AnnotationBase* leftAnnotation, const AnnotationBase* rightAnnotation) {
+			return typeid(*leftAnnotation) == typeid(*rightAnnotation) && *leftAnnotation == *rightAnnotation;
+		});
+}
+
+// Contiguous storage of the entries of a dense Table.
+class DenseArrayBase {
+public:
+	DenseArrayBase(std::unique_ptr<ValueBase> prototype) : prototype(std::move(prototype)) {}
+	virtual ~DenseArrayBase() = default;
+
+	virtual std::unique_ptr<DenseArrayBase> copy() const = 0;
+	virtual size_t size() const = 0;
+	virtual ValueBase* element(size_t index) = 0;
+	virtual void insert(size_t index, const std::string& name, const ValueBase& value) = 0;
+	virtual void erase(size_t index) = 0;
+	virtual void set(size_t index, const ValueBase& value) = 0;
+	// Append the indices of the values which differ from those of an array with the same layout.
+	virtual void differences(const DenseArrayBase& other, std::vector<size_t>& indices) const = 0;
+
+	// Check if the value can be stored as an entry.
+	bool accepts(const ValueBase& value) const {
+		return ValueBase::classesEqual(value.classPrototype(), *prototype) && annotationsEqual(value, *prototype);
+	}
+
+	bool sameLayout(const DenseArrayBase& other) const {
+		return typeid(*this) == typeid(other) && ValueBase::classesEqual(*prototype, *other.prototype) && names == other.names;
+	}
+
+	std::vector<std::string> names;
+	// Provides class and annotations of all entries.
+	std::unique_ptr<ValueBase> prototype;
+};
+
+template <typename T>
+class DenseArray;
+
+// Entry of a dense Table: a view of one of the contiguous values.
+template <typename T>
+class DenseElement : public ValueBase {
+public:
+	DenseElement(DenseArray<T>* array, size_t index) : array_(array), index_(index) {}
+
+	PrimitiveType type() const override {
+		return primitiveType<T>();
+	}
+	std::string typeName() const override {
+		return array_->prototype->typeName();
+	}
+	const ValueBase& classPrototype() const override {
+		return *array_->prototype;
+	}
+
+	bool& asBool() override {
+		return valueAs<bool>();
+	}
+	int& asInt() override {
+		return valueAs<int>();
+	}
+	double& asDouble() override {
+		return valueAs<double>();
+	}
+	std::string& asString() override {
+		return valueAs<std::string>();
+	}
+	Table& asTable() override {
+		return valueAs<Table>();
+	}
+	Vec2f& asVec2f() override {
+		return valueAs<Vec2f>();
+	}
+	Vec3f& asVec3f() override {
+		return valueAs<Vec3f>();
+	}
+	Vec4f& asVec4f() override {
+		return valueAs<Vec4f>();
+	}
+	Vec2i& asVec2i() override {
+		return valueAs<Vec2i>();
+	}
+	Vec3i& asVec3i() override {
+		return valueAs<Vec3i>();
+	}
+	Vec4i& asVec4i() override {
+		return valueAs<Vec4i>();
+	}
+
+	const bool& asBool() const override {
+		return valueAs<bool>();
+	}
+	const int& asInt() const override {
+		return valueAs<int>();
+	}
+	const double& asDouble() const override {
+		return valueAs<double>();
+	}
+	const std::string& asString() const override {
+		return valueAs<std::string>();
+	}
+	const Table& asTable() const override {
+		return valueAs<Table>();
+	}
+	const Vec2f& asVec2f() const override {
+		return valueAs<Vec2f>();
+	}
+	const Vec3f& asVec3f() const override {
+		return valueAs<Vec3f>();
+	}
+	const Vec4f& asVec4f() const override {
+		return valueAs<Vec4f>();
+	}
+	const Vec2i& asVec2i() const override {
+		return valueAs<Vec2i>();
+	}
+	const Vec3i& asVec3i() const override {
+		return valueAs<Vec3i>();
+	}
+	const Vec4i& asVec4i() const override {
+		return valueAs<Vec4i>();
+	}
+
+	ReflectionInterface& getSubstructure() override {
+		return valueAs<ReflectionInterface>();
+	}
+	const ReflectionInterface& getSubstructure() const override {
+		return valueAs<ReflectionInterface>();
+	}
+
+	SEditorObject asRef() const override {
+		throw std::runtime_error("type mismatch");
+	}
+	void setRef(SEditorObject) override {
+	}
+	bool canSetRef(SEditorObject) const override {
+		return false;
+	}
+	const ClassWithReflectedMembers& asStruct() const override {
+		throw std::runtime_error("type mismatch");
+	}
+	void setStruct(const ClassWithReflectedMembers&) override {
+	}
+
+	ValueBase& operator=(const ValueBase& other) override {
+		valueAs<T>() = other.as<T>();
+		return *this;
+	}
+
+	bool assign(const ValueBase& other, bool includeAnnoData = false) override {
+		if (includeAnnoData) {
+			copyAnnotationData(other);
+		}
+		if (!(valueAs<T>() == other.as<T>())) {
+			valueAs<T>() = other.as<T>();
+			return true;
+		}
+		return false;
+	}
+
+	bool operator==(const ValueBase& other) const override {
+		return classesEqual(*this, other) && valueAs<T>() == other.as<T>();
+	}
+
+	// The annotations are shared by all entries of the Table.
+	void copyAnnotationData(const ValueBase& src) override {
+		array_->prototype->copyAnnotationData(src.classPrototype());
+	}
+
+	const std::vector<AnnotationBase*>& baseAnnotationPtrs() const override {
+		return array_->prototype->baseAnnotationPtrs();
+	}
+	const std::vector<AnnotationBase*>& modifiableAnnotationPtrs() override {
+		return array_->prototype->modifiableAnnotationPtrs();
+	}
+	void annotationsModified() override {
+		array_->prototype->annotationsModified();
+	}
+
+	std::unique_ptr<ValueBase> clone(std::function<SEditorObject(SEditorObject)>* translateRef) const override {
+		std::unique_ptr<ValueBase> result = array_->prototype->clone(nullptr);
+		result->as<T>() = valueAs<T>();
+		return result;
+	}
+
+private:
+	template <typename U>
+	U& valueAs() const {
+		if constexpr (std::is_same<T, U>::value) {
+			return array_->values[index_];
+		}
+		throw std::runtime_error("type mismatch");
+	}
+
+	DenseArray<T>* array_;
+	size_t index_;
+};
+
+template <typename T>
+class DenseArray : public DenseArrayBase {
+public:
+	using DenseArrayBase::DenseArrayBase;
+
+	std::unique_ptr<DenseArrayBase> copy() const override {
+		auto result = std::make_unique<DenseArray>(prototype->clone(nullptr));
+		result->names = names;
+		result->values = values;
+		result->elements.reserve(values.size());
+		for (size_t index = 0; index < values.size(); index++) {
+			result->elements.emplace_back(result.get(), index);
+		}
+		return result;
+	}
+
+	size_t size() const override {
+		return values.size();
+	}
+
+	ValueBase* element(size_t index) override {
+		return &elements[index];
+	}
+
+	// The entries only refer to a position, so inserting and erasing values just needs the number of entries to match.
+	void insert(size_t index, const std::string& name, const ValueBase& value) override {
+		names.insert(names.begin() + index, name);
+		values.insert(values.begin() + index, value.as<T>());
+		elements.emplace_back(this, elements.size());
+	}
+
+	void erase(size_t index) override {
+		names.erase(names.begin() + index);
+		values.erase(values.begin() + index);
+		elements.pop_back();
+	}
+
+	void set(size_t index, const ValueBase& value) override {
+		values[index] = value.as<T>();
+	}
+
+	void differences(const DenseArrayBase& other, std::vector<size_t>& indices) const override {
+		auto const& otherValues = static_cast<const DenseArray&>(other).values;
+		for (size_t index = 0; index < values.size(); index++) {
+			if (values[index] != otherValues[index]) {
+				indices.emplace_back(index);
+			}
+		}
+	}
+
+	std::vector<T> values;
+	std::vector<DenseElement<T>> elements;
+};
+
+bool containsReferences(const ValueBase& value);
+
+bool containsReferences(const ReflectionInterface& object) {
+	for (size_t index = 0; index < object.size(); index++) {
+		if (containsReferences(*object.get(index))) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool containsReferences(const ValueBase& value) {
+	switch (value.type()) {
+		case PrimitiveType::Ref:
+			return true;
+		case PrimitiveType::Table:
+			return value.asTable().containsReferences();
+		case PrimitiveType::Struct:
+			return containsReferences(value.getSubstructure());
+		default:
+			return false;
+	}
+}
+
+}  // namespace
+
+struct Table::Payload {
+	enum class References { Unknown, No, Yes };
+
+	Entries entries;
+	// Replaces the entries of dense Tables.
+	std::unique_ptr<DenseArrayBase> dense;
+	// Cached result of containsReferences(); reset whenever the entries are handed out for modification.
+	mutable std::atomic<References> references{References::Unknown};
+};
+
 Table::Table(const Table& other, std::function<SEditorObject(SEditorObject)>* translateRef) {
-	for (auto const& item : other.properties_) {
-		addProperty(item.first, item.second->clone(translateRef));
+	if (!translateRef || !other.containsReferences()) {
+		payload_ = other.payload_;
+		return;
+	}
+	// Values without references don't need the translation and can keep sharing nested Tables.
+	// Dense Tables never contain references.
+	payload_ = std::make_shared<Payload>();
+	payload_->entries.reserve(other.size());
+	for (auto const& item : other.payload_->entries) {
+		payload_->entries.emplace_back(item.first, item.second->clone(data_storage::containsReferences(*item.second) ? translateRef : nullptr));
 	}
 }
 
-ValueBase* Table::get(std::string const& propertyName) {
-	auto it = std::find_if(properties_.begin(), properties_.end(),
-		[&propertyName](auto const& item) {
-			return item.first == propertyName;
+Table::Payload& Table::mutablePayload() {
+	if (!payload_) {
+		payload_ = std::make_shared<Payload>();
+	} else if (payload_.use_count() > 1) {
+		auto copy = std::make_shared<Payload>();
+		if (payload_->dense) {
+			copy->dense = payload_->dense->copy();
+		} else {
+			copy->entries.reserve(payload_->entries.size());
+			for (auto const& item : payload_->entries) {
+				copy->entries.emplace_back(item.first, item.second->clone(nullptr));
+			}
+		}
+		payload_ = std::move(copy);
+	}
+	payload_->references = Payload::References::Unknown;
+	return *payload_;
+}
+
+Table::Entries& Table::mutableEntries() {
+	auto& payload = mutablePayload();
+	if (payload.dense) {
+		auto& dense = *payload.dense;
+		payload.entries.reserve(dense.size());
+		for (size_t index = 0; index < dense.size(); index++) {
+			payload.entries.emplace_back(dense.names[index], dense.element(index)->clone(nullptr));
+		}
+		payload.dense.reset();
+	}
+	return payload.entries;
+}
+
+bool Table::containsReferences() const {
+	if (!payload_) {
+		return false;
+	}
+	auto scan = [this]() {
+		return std::any_of(payload_->entries.begin(), payload_->entries.end(), [](auto const& item) {
+			return data_storage::containsReferences(*item.second);
 		});
-	if (it != properties_.end()) {
-		return it->second.get();
+	};
+	// Nested Tables of an unshared payload may still be modified through previously obtained pointers,
+	// so the result can only be cached while the payload is shared.
+	if (payload_.use_count() == 1) {
+		return scan();
+	}
+	auto references = payload_->references.load(std::memory_order_relaxed);
+	if (references == Payload::References::Unknown) {
+		references = scan() ? Payload::References::Yes : Payload::References::No;
+		payload_->references.store(references, std::memory_order_relaxed);
+	}
+	return references == Payload::References::Yes;
+}
+
+bool Table::makeDense() {
+	if (isDense()) {
+		return true;
+	}
+	if (size() == 0) {
+		return false;
+	}
+	const Table& table = *this;
+	const ValueBase& first = *table.get(0);
+	std::unique_ptr<DenseArrayBase> dense;
+	switch (first.type()) {
+		case PrimitiveType::Int:
+			dense = std::make_unique<DenseArray<int>>(first.clone(nullptr));
+			break;
+		case PrimitiveType::Double:
+			dense = std::make_unique<DenseArray<double>>(first.clone(nullptr));
+			break;
+		default:
+			return false;
+	}
+	for (size_t index = 0; index < table.size(); index++) {
+		const ValueBase& value = *table.get(index);
+		if (!dense->accepts(value)) {
+			return false;
+		}
+		dense->insert(index, table.name(index), value);
+	}
+	// Other copies keep the previous payload.
+	payload_ = std::make_shared<Payload>();
+	payload_->dense = std::move(dense);
+	return true;
+}
+
+bool Table::isDense() const {
+	return payload_ && payload_->dense;
+}
+
+template <typename T>
+const T* Table::denseData() const {
+	if (payload_) {
+		if (auto dense = dynamic_cast<DenseArray<T>*>(payload_->dense.get())) {
+			return dense->values.data();
+		}
+	}
+	return nullptr;
+}
+
+template <typename T>
+T* Table::denseData() {
+	if (!std::as_const(*this).denseData<T>()) {
+		return nullptr;
+	}
+	return static_cast<DenseArray<T>*>(mutablePayload().dense.get())->values.data();
+}
+
+template const int* Table::denseData<int>() const;
+template const double* Table::denseData<double>() const;
+template int* Table::denseData<int>();
+template double* Table::denseData<double>();
+
+bool Table::assignDense(const Table& source, std::vector<size_t>& changedIndices) {
+	changedIndices.clear();
+	if (!isDense() || !source.isDense() || !payload_->dense->sameLayout(*source.payload_->dense)) {
+		return false;
+	}
+	if (payload_ != source.payload_) {
+		payload_->dense->differences(*source.payload_->dense, changedIndices);
+		if (!changedIndices.empty() || !annotationsEqual(*payload_->dense->prototype, *source.payload_->dense->prototype)) {
+			payload_ = source.payload_;
+		}
+	}
+	return true;
+}
+
+ValueBase* Table::get(std::string const& propertyName) {
+	int ind = index(propertyName);
+	if (ind != -1) {
+		return get(static_cast<size_t>(ind));
 	}
 	return nullptr;
 }
 
 ValueBase* Table::get(size_t index) {
-	if (index < properties_.size()) {
-		return properties_[index].second.get();
+	if (index < size()) {
+		auto& payload = mutablePayload();
+		return payload.dense ? payload.dense->element(index) : payload.entries[index].second.get();
 	}
 	return nullptr;
 }
 
 const ValueBase* Table::get(std::string const& propertyName) const {
-	auto it = std::find_if(properties_.begin(), properties_.end(),
-		[&propertyName](auto const& item) {
-			return item.first == propertyName;
-		});
-	if (it != properties_.end()) {
-		return it->second.get();
+	int ind = index(propertyName);
+	if (ind != -1) {
+		return get(static_cast<size_t>(ind));
 	}
 	return nullptr;
 }
 
 const ValueBase* Table::get(size_t index) const {
-	if (index < properties_.size()) {
-		return properties_[index].second.get();
+	if (index < size()) {
+		return payload_->dense ? payload_->dense->element(index) : payload_->entries[index].second.get();
 	}
 	return nullptr;
 }
 
 
 size_t Table::size() const {
-	return properties_.size();
+	if (!payload_) {
+		return 0;
+	}
+	return payload_->dense ? payload_->dense->size() : payload_->entries.size();
 }
 
 std::string Table::name(size_t index) const {
-	assert(index < properties_.size());
-	return properties_[index].first;
+	assert(index < size());
+	return payload_->dense ? payload_->dense->names[index] : payload_->entries[index].first;
 }
 
 int Table::index(std::string const& propertyName) const {
-	auto it = std::find_if(properties_.begin(), properties_.end(),
+	if (!payload_) {
+		return -1;
+	}
+	if (payload_->dense) {
+		auto const& names = payload_->dense->names;
+		auto it = std::find(names.begin(), names.end(), propertyName);
+		if (it != names.end()) {
+			return static_cast<int>(it - names.begin());
+		}
+		return -1;
+	}
+	auto const& properties = payload_->entries;
+	auto it = std::find_if(properties.begin(), properties.end(),
 		[&propertyName](auto const& item) {
 			return item.first == propertyName;
 		});
-	if (it != properties_.end()) {
-		return static_cast<int>(it - properties_.begin());
+	if (it != properties.end()) {
+		return static_cast<int>(it - properties.begin());
 	}
 	return -1;
 }
@@ -82,42 +524,35 @@ int Table::index(std::string const& propertyName) const {
 
 ValueBase *Table::addProperty(std::string const &name, PrimitiveType type)
 {
-	properties_.emplace_back(std::make_pair(name, ValueBase::create(type)));
-	return properties_.back().second.get();
+	return addProperty(name, ValueBase::create(type));
 }
 
 ValueBase* Table::addProperty(std::string const& name, ValueBase* property, int index_before) {
-	assert(index_before >= -1 && index_before <= static_cast<int>(properties_.size()));
-
-	if (index_before == -1) {
-		properties_.emplace_back(std::make_pair(name, std::unique_ptr<ValueBase>(property)));
-		return properties_.back().second.get();
-	}
-
-	return properties_.insert(properties_.begin() + index_before, std::make_pair(name, std::unique_ptr<ValueBase>(property)))->second.get();
+	return addProperty(name, std::unique_ptr<ValueBase>(property), index_before);
 }
 
 ValueBase* Table::addProperty(const std::string& name, std::unique_ptr<ValueBase>&& property, int index_before) {
-	assert(index_before >= -1 && index_before <= static_cast<int>(properties_.size()));
+	assert(index_before >= -1 && index_before <= static_cast<int>(size()));
 
+	auto& payload = mutablePayload();
+	if (payload.dense && payload.dense->accepts(*property)) {
+		size_t index = index_before == -1 ? payload.dense->size() : index_before;
+		payload.dense->insert(index, name, *property);
+		return payload.dense->element(index);
+	}
+
+	auto& properties = mutableEntries();
 	if (index_before == -1) {
-		properties_.emplace_back(std::make_pair(name, std::move(property)));
-		return properties_.back().second.get();
+		properties.emplace_back(std::make_pair(name, std::move(property)));
+		return properties.back().second.get();
 	}
 
-	return properties_.insert(properties_.begin() + index_before, std::make_pair(name, std::move(property)))->second.get();
+	return properties.insert(properties.begin() + index_before, std::make_pair(name, std::move(property)))->second.get();
 }
 
 
 ValueBase* Table::addProperty(PrimitiveType type, int index_before) {
-	assert(index_before >= -1 && index_before <= static_cast<int>(properties_.size()));
-
-	if (index_before == -1) {
-		properties_.emplace_back(std::make_pair(std::string(), ValueBase::create(type)));
-		return properties_.back().second.get();
-	}
-
-	return properties_.insert(properties_.begin() + index_before, std::make_pair(std::string(), ValueBase::create(type)))->second.get();
+	return addProperty(std::string(), ValueBase::create(type), index_before);
 }
 
 ValueBase* Table::addProperty(ValueBase* property, int index_before) {
@@ -125,19 +560,17 @@ ValueBase* Table::addProperty(ValueBase* property, int index_before) {
 }
 
 ValueBase* Table::addProperty(std::unique_ptr<ValueBase>&& property, int index_before) {
-	assert(index_before >= -1 && index_before <= static_cast<int>(properties_.size()));
-
-	if (index_before == -1) {
-		properties_.emplace_back(std::make_pair(std::string(), std::move(property)));
-		return properties_.back().second.get();
-	}
-
-	return properties_.insert(properties_.begin() + index_before, std::make_pair(std::string(), std::move(property)))->second.get();
+	return addProperty(std::string(), std::move(property), index_before);
 }
 
 void Table::removeProperty(size_t index) {
-	assert(index < properties_.size());
-	properties_.erase(properties_.begin() + index);
+	assert(index < size());
+	auto& payload = mutablePayload();
+	if (payload.dense) {
+		payload.dense->erase(index);
+	} else {
+		payload.entries.erase(payload.entries.begin() + index);
+	}
 }
 
 void Table::removeProperty(std::string const &propertyName) {
@@ -148,24 +581,33 @@ void Table::removeProperty(std::string const &propertyName) {
 }
 
 void Table::renameProperty(const std::string& oldName, const std::string& newName) {
-	auto it = std::find_if(properties_.begin(), properties_.end(),
-		[&oldName](auto const& item) {
-			return item.first == oldName;
-		});
-	if (it != properties_.end()) {
-		it->first = newName;
+	int ind = index(oldName);
+	if (ind != -1) {
+		auto& payload = mutablePayload();
+		if (payload.dense) {
+			payload.dense->names[ind] = newName;
+		} else {
+			payload.entries[ind].first = newName;
+		}
 	}
 }
 
 void Table::replaceProperty(size_t index, ValueBase* property) {
-	if (index < properties_.size()) {
-		properties_[index].second = std::unique_ptr<ValueBase>(property);
+	std::unique_ptr<ValueBase> value(property);
+	if (index < size()) {
+		auto& payload = mutablePayload();
+		if (payload.dense && payload.dense->accepts(*value)) {
+			payload.dense->set(index, *value);
+		} else {
+			mutableEntries()[index].second = std::move(value);
+		}
 	}
 }
 
 
 void Table::clear() {
-	properties_.clear();
+	// No need to copy the entries just to drop them.
+	payload_.reset();
 }
 
 template<typename T>
@@ -175,7 +617,7 @@ template<> struct TypeMap<std::string> { static const PrimitiveType primType = P
 
 template<typename T>
 void Table::set(std::vector<T> const& array) {
-	properties_.clear();
+	clear();
 
 	for (auto item : array) {
 		ValueBase* prop = addProperty(TypeMap<T>::primType);
@@ -190,8 +632,8 @@ template<typename T>
 std::vector<T> Table::asVector() const {
 
 	std::vector<T> result;
-	for (auto const &prop : properties_) {
-		result.push_back(prop.second->as<T>());
+	for (size_t index = 0; index < size(); index++) {
+		result.push_back(get(index)->as<T>());
 	}
 	return result;
 }
@@ -200,22 +642,24 @@ template<>
 std::vector<SEditorObject> Table::asVector<SEditorObject>() const {
 
 	std::vector<SEditorObject> result;
-	for (auto const& prop : properties_) {
-		result.push_back(prop.second->asRef());
+	for (size_t index = 0; index < size(); index++) {
+		result.push_back(get(index)->asRef());
 	}
 	return result;
 }
 
+template std::vector<int> Table::asVector<int>() const;
+template std::vector<double> Table::asVector<double>() const;
 template std::vector<std::string> Table::asVector<std::string>() const;
 
 
 template <typename T>
 bool Table::compare(std::vector<T> const& array) const {
-	if (array.size() != properties_.size()) {
+	if (array.size() != size()) {
 		return false;
 	}
-	for (size_t i = 0; i < properties_.size(); i++) {
-		if (properties_[i].second->as<T>() != array[i]) {
+	for (size_t i = 0; i < size(); i++) {
+		if (get(i)->as<T>() != array[i]) {
 			return false;
 		}
 	}
@@ -226,18 +670,24 @@ template bool Table::compare<std::string>(std::vector<std::string> const& array)
 
 
 Table& Table::operator=(const Table& value) {
-	properties_.clear();
-	for (auto const &item : value.properties_) {
-		ValueBase* prop = addProperty(item.first, item.second->type());
-		*prop = *item.second;
+	if (&value == this) {
+		return *this;
+	}
+	clear();
+	if (value.size() > 0) {
+		mutableEntries().reserve(value.size());
+		for (size_t index = 0; index < value.size(); index++) {
+			ValueBase* prop = addProperty(value.name(index), value.get(index)->type());
+			*prop = *value.get(index);
+		}
 	}
 	return *this;
 }
 
 std::vector<std::string> Table::propertyNames() const {
 	std::vector<std::string> result;
-	for (auto const& prop : properties_) {
-		result.emplace_back(prop.first);
+	for (size_t index = 0; index < size(); index++) {
+		result.emplace_back(name(index));
 	}
 	return result;
 }
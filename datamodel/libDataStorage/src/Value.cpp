@@ -213,7 +213,7 @@ const Vec4i& ValueBase::as<Vec4i>() const {
 }
 
 bool ValueBase::classesEqual(const ValueBase& left, const ValueBase& right) {
-	return typeid(left) == typeid(right);
+	return typeid(left) == typeid(right) && typeid(left.classPrototype()) == typeid(right.classPrototype());
 }
 
 ValueBase& ValueBase::operator=(bool value) {
@@ -0,0 +1,289 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "data_storage/ValueAllocator.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace raco::data_storage {
+
+namespace {
+
+constexpr size_t SIZE_CLASS_GRANULARITY = alignof(std::max_align_t);
+constexpr size_t NUM_SIZE_CLASSES = ValueAllocator::MAX_SLAB_OBJECT_SIZE / SIZE_CLASS_GRANULARITY;
+
+// Number of free blocks a thread keeps per size class before it returns them to the shared pool.
+constexpr size_t MAX_CACHED_BLOCKS = 1024;
+// Number of blocks a thread takes from the shared pool at once.
+constexpr size_t REFILL_BLOCKS = MAX_CACHED_BLOCKS / 2;
+
+size_t sizeClassIndex(size_t size) {
+	return size == 0 ? 0 : (size - 1) / SIZE_CLASS_GRANULARITY;
+}
+
+size_t blockSize(size_t sizeClass) {
+	return (sizeClass + 1) * SIZE_CLASS_GRANULARITY;
+}
+
+struct FreeBlock {
+	FreeBlock* next;
+};
+
+// Singly linked list of free blocks of one size class.
+struct FreeList {
+	FreeBlock* head = nullptr;
+	FreeBlock* tail = nullptr;
+	size_t size = 0;
+
+	void push(FreeBlock* block) {
+		block->next = head;
+		head = block;
+		if (!tail) {
+			tail = block;
+		}
+		size++;
+	}
+
+	FreeBlock* pop() {
+		FreeBlock* block = head;
+		head = block->next;
+		if (!head) {
+			tail = nullptr;
+		}
+		size--;
+		return block;
+	}
+
+	// Move the first `count` blocks into a new list.
+	FreeList split(size_t count) {
+		if (count >= size) {
+			return std::exchange(*this, FreeList{});
+		}
+		FreeList front{head, head, count};
+		for (size_t index = 1; index < count; index++) {
+			front.tail = front.tail->next;
+		}
+		head = front.tail->next;
+		front.tail->next = nullptr;
+		size -= count;
+		return front;
+	}
+
+	// Prepend all blocks of another list.
+	void splice(FreeList& other) {
+		if (other.head) {
+			other.tail->next = head;
+			head = other.head;
+			if (!tail) {
+				tail = other.tail;
+			}
+			size += other.size;
+			other = FreeList{};
+		}
+	}
+};
+
+// Allocation counters of one thread. Only the owning thread writes them, so they don't need atomic increments.
+struct Counters {
+	std::atomic<size_t> allocations{0};
+	std::atomic<size_t> deallocations{0};
+	std::atomic<size_t> largeAllocations{0};
+
+	static void increment(std::atomic<size_t>& counter) {
+		counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	}
+};
+
+// Slabs and free blocks shared by all threads.
+class SharedPool {
+public:
+	// Fill an empty thread cache list: from blocks returned by other threads if possible, otherwise from a new slab.
+	void refill(size_t sizeClass, FreeList& list) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		FreeList& shared = freeLists_[sizeClass];
+		if (shared.size > 0) {
+			list = shared.split(REFILL_BLOCKS);
+		} else {
+			addSlab(sizeClass, list);
+		}
+	}
+
+	// Allocation without thread cache, used after the cache of the calling thread has been destroyed.
+	void* allocate(size_t size) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		retired_.allocations++;
+		if (size > ValueAllocator::MAX_SLAB_OBJECT_SIZE) {
+			retired_.largeAllocations++;
+			return ::operator new(size);
+		}
+		FreeList& shared = freeLists_[sizeClassIndex(size)];
+		if (shared.size == 0) {
+			addSlab(sizeClassIndex(size), shared);
+		}
+		return shared.pop();
+	}
+
+	void deallocate(void* pointer, size_t size) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		retired_.deallocations++;
+		if (size > ValueAllocator::MAX_SLAB_OBJECT_SIZE) {
+			::operator delete(pointer);
+		} else {
+			freeLists_[sizeClassIndex(size)].push(static_cast<FreeBlock*>(pointer));
+		}
+	}
+
+	void release(size_t sizeClass, FreeList& list) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		freeLists_[sizeClass].splice(list);
+	}
+
+	void addThread(const Counters* counters) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		threads_.emplace_back(counters);
+	}
+
+	void removeThread(const Counters* counters) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		add(retired_, *counters);
+		threads_.erase(std::find(threads_.begin(), threads_.end(), counters));
+	}
+
+	ValueAllocator::Statistics statistics() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		ValueAllocator::Statistics statistics = retired_;
+		for (auto counters : threads_) {
+			add(statistics, *counters);
+		}
+		statistics.slabs = slabs_.size();
+		statistics.slabBytes = statistics.slabs * ValueAllocator::SLAB_SIZE;
+		return statistics;
+	}
+
+private:
+	static void add(ValueAllocator::Statistics& statistics, const Counters& counters) {
+		statistics.allocations += counters.allocations.load(std::memory_order_relaxed);
+		statistics.deallocations += counters.deallocations.load(std::memory_order_relaxed);
+		statistics.largeAllocations += counters.largeAllocations.load(std::memory_order_relaxed);
+	}
+
+	// Split a new slab into blocks of the size class.
+	void addSlab(size_t sizeClass, FreeList& list) {
+		size_t size = blockSize(sizeClass);
+		size_t numBlocks = ValueAllocator::SLAB_SIZE / size;
+		slabs_.emplace_back(new std::max_align_t[ValueAllocator::SLAB_SIZE / sizeof(std::max_align_t)]);
+		// Link the blocks in address order, so that objects allocated one after another are adjacent in memory.
+		auto slab = reinterpret_cast<char*>(slabs_.back().get());
+		for (size_t index = numBlocks; index-- > 0;) {
+			list.push(reinterpret_cast<FreeBlock*>(slab + index * size));
+		}
+	}
+
+	std::mutex mutex_;
+	std::array<FreeList, NUM_SIZE_CLASSES> freeLists_;
+	std::vector<std::unique_ptr<std::max_align_t[]>> slabs_;
+	std::vector<const Counters*> threads_;
+	ValueAllocator::Statistics retired_{};
+};
+
+SharedPool& sharedPool() {
+	// Never destroyed, since Values with static storage duration may be deallocated after the pool would be destroyed.
+	static SharedPool* pool = new SharedPool();
+	return *pool;
+}
+
+// Set at thread exit when the cache of the thread has been destroyed: Values freed later, e.g. by the destructors
+// of static objects, use the shared pool directly.
+thread_local bool threadCacheDestroyed = false;
+
+// Free blocks owned by one thread; allocation and deallocation don't need any locking.
+// Blocks freed by another thread than the allocating one simply end up in the cache of the freeing thread.
+class ThreadCache {
+public:
+	ThreadCache() {
+		sharedPool().addThread(&counters_);
+	}
+
+	~ThreadCache() {
+		for (size_t sizeClass = 0; sizeClass < NUM_SIZE_CLASSES; sizeClass++) {
+			sharedPool().release(sizeClass, freeLists_[sizeClass]);
+		}
+		sharedPool().removeThread(&counters_);
+		threadCacheDestroyed = true;
+	}
+
+	void* allocate(size_t size) {
+		Counters::increment(counters_.allocations);
+		if (size > ValueAllocator::MAX_SLAB_OBJECT_SIZE) {
+			Counters::increment(counters_.largeAllocations);
+			return ::operator new(size);
+		}
+		size_t sizeClass = sizeClassIndex(size);
+		FreeList& list = freeLists_[sizeClass];
+		if (list.size == 0) {
+			sharedPool().refill(sizeClass, list);
+		}
+		return list.pop();
+	}
+
+	void deallocate(void* pointer, size_t size) {
+		Counters::increment(counters_.deallocations);
+		if (size > ValueAllocator::MAX_SLAB_OBJECT_SIZE) {
+			::operator delete(pointer);
+			return;
+		}
+		size_t sizeClass = sizeClassIndex(size);
+		FreeList& list = freeLists_[sizeClass];
+		if (list.size >= MAX_CACHED_BLOCKS) {
+			sharedPool().release(sizeClass, list);
+		}
+		list.push(static_cast<FreeBlock*>(pointer));
+	}
+
+private:
+	std::array<FreeList, NUM_SIZE_CLASSES> freeLists_;
+	Counters counters_;
+};
+
+ThreadCache& threadCache() {
+	thread_local ThreadCache cache;
+	return cache;
+}
+
+}  // namespace
+
+void* ValueAllocator::allocate(size_t size) {
+	if (threadCacheDestroyed) {
+		return sharedPool().allocate(size);
+	}
+	return threadCache().allocate(size);
+}
+
+void ValueAllocator::deallocate(void* pointer, size_t size) noexcept {
+	if (pointer) {
+		if (threadCacheDestroyed) {
+			sharedPool().deallocate(pointer, size);
+		} else {
+			threadCache().deallocate(pointer, size);
+		}
+	}
+}
+
+ValueAllocator::Statistics ValueAllocator::statistics() {
+	return sharedPool().statistics();
+}
+
+}  // namespace raco::data_storage
@@ -83,3 +83,37 @@ TEST(AnnotationQueryTest, ClassWithVec3f)
 	RangeAnnotation<double>* range = c.v->x.dynamicQuery<RangeAnnotation<double>>();
 }
 
+
+TEST(AnnotationQueryTest, Vec3f_shared_annotations)
+{
+	Vec3f a(0.0, 1.0, -10.0, 10.0);
+	Vec3f b(5.0, 1.0, -10.0, 10.0);
+	EXPECT_EQ(a.x.baseAnnotationPtrs(), b.x.baseAnnotationPtrs());
+	EXPECT_EQ(&a.x.baseAnnotationPtrs(), &b.x.baseAnnotationPtrs());
+	EXPECT_NE(&a.x.baseAnnotationPtrs(), &a.y.baseAnnotationPtrs());
+	EXPECT_EQ(*a.y.dynamicQuery<DisplayNameAnnotation>()->name_, "Y");
+
+	// Modifying the annotations of one component doesn't change the other vectors.
+	a.x.staticQuery<RangeAnnotation<double>>().max_ = 20.0;
+	EXPECT_EQ(*a.x.dynamicQuery<RangeAnnotation<double>>()->max_, 20.0);
+	EXPECT_EQ(*b.x.dynamicQuery<RangeAnnotation<double>>()->max_, 10.0);
+
+	// Copies keep their own modified annotations.
+	Vec3f c(a);
+	EXPECT_EQ(*c.x.dynamicQuery<RangeAnnotation<double>>()->max_, 20.0);
+	EXPECT_NE(c.x.dynamicQuery<RangeAnnotation<double>>(), a.x.dynamicQuery<RangeAnnotation<double>>());
+
+	b.copyAnnotationData(a);
+	EXPECT_EQ(*b.x.dynamicQuery<RangeAnnotation<double>>()->max_, 20.0);
+	EXPECT_EQ(b.y.dynamicQuery<RangeAnnotation<double>>(), a.y.dynamicQuery<RangeAnnotation<double>>());
+
+	// Modified annotations are shared again after annotationsModified(), e.g. after deserialization.
+	Vec3f d(0.0, 1.0, -10.0, 10.0);
+	auto range = dynamic_cast<RangeAnnotation<double>*>(d.x.modifiableAnnotationPtrs()[1]);
+	range->max_ = 20.0;
+	EXPECT_EQ(*Vec3f(0.0, 1.0, -10.0, 10.0).x.dynamicQuery<RangeAnnotation<double>>()->max_, 10.0);
+	d.x.annotationsModified();
+	Vec3f e(0.0, 1.0, -10.0, 20.0);
+	EXPECT_EQ(&d.x.baseAnnotationPtrs(), &e.x.baseAnnotationPtrs());
+	EXPECT_EQ(*d.x.dynamicQuery<RangeAnnotation<double>>()->max_, 20.0);
+}
@@ -0,0 +1,125 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "data_storage/BasicTypes.h"
+#include "data_storage/Value.h"
+
+#include "StructTypes.h"
+
+#include <array>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+using namespace raco::data_storage;
+
+namespace {
+
+constexpr size_t NUM_WIDE_PROPERTIES = 24;
+
+// Registers its properties like EditorObject subclasses do: base class properties first, one at a time.
+class WideBase : public ClassWithReflectedMembers {
+public:
+	static inline const TypeDescriptor typeDescription = {"WideBase", false};
+	TypeDescriptor const& getTypeDescription() const override {
+		return typeDescription;
+	}
+	bool serializationRequired() const override {
+		return false;
+	}
+
+	WideBase() {
+		for (size_t i = 0; i < NUM_WIDE_PROPERTIES / 2; i++) {
+			properties_.emplace_back("baseProperty" + std::to_string(i), &values_[i]);
+		}
+	}
+
+	std::array<Property<int>, NUM_WIDE_PROPERTIES> values_;
+};
+
+class Wide : public WideBase {
+public:
+	Wide() {
+		for (size_t i = NUM_WIDE_PROPERTIES / 2; i < NUM_WIDE_PROPERTIES; i++) {
+			properties_.emplace_back("derivedProperty" + std::to_string(i), &values_[i]);
+		}
+	}
+};
+
+}  // namespace
+
+TEST(ReflectionInterfaceTest, instances_share_schema) {
+	Vec3f a;
+	Vec3f b{1.0};
+	EXPECT_EQ(&a.propertySchema(), &b.propertySchema());
+	EXPECT_NE(&a.propertySchema(), &Vec4f().propertySchema());
+
+	EXPECT_EQ(a.get("y"), &a.y);
+	EXPECT_EQ(b.get("z"), &b.z);
+	EXPECT_EQ(a.index("w"), -1);
+	EXPECT_EQ(a.get("w"), nullptr);
+	EXPECT_EQ(a.name(2), "z");
+}
+
+TEST(ReflectionInterfaceTest, schema_independent_of_registration) {
+	Wide wide;
+	Wide other;
+	EXPECT_EQ(&wide.propertySchema(), &other.propertySchema());
+	ASSERT_EQ(wide.size(), NUM_WIDE_PROPERTIES);
+
+	// Same names registered all at once.
+	std::vector<std::pair<std::string, ValueBase*>> properties;
+	for (size_t i = 0; i < NUM_WIDE_PROPERTIES; i++) {
+		properties.emplace_back(wide.name(i), wide.get(i));
+	}
+	ReflectedProperties sameNames(std::move(properties));
+	EXPECT_EQ(&sameNames.schema(), &wide.propertySchema());
+}
+
+TEST(ReflectionInterfaceTest, lookup_in_large_schema) {
+	Wide wide;
+	for (size_t i = 0; i < NUM_WIDE_PROPERTIES; i++) {
+		EXPECT_EQ(wide.index(wide.name(i)), static_cast<int>(i));
+		EXPECT_EQ(wide.get(wide.name(i)), &wide.values_[i]);
+	}
+	EXPECT_EQ(wide.index("baseProperty"), -1);
+	EXPECT_EQ(wide.index("derivedProperty0"), -1);
+	EXPECT_EQ(wide.get(""), nullptr);
+}
+
+TEST(ReflectionInterfaceTest, extend_yields_same_schema_from_all_threads) {
+	constexpr size_t numThreads = 4;
+	std::array<const PropertySchema*, numThreads> schemas;
+	std::vector<std::thread> threads;
+	for (size_t thread = 0; thread < numThreads; thread++) {
+		threads.emplace_back([&schemas, thread]() {
+			auto schema = PropertySchema::empty();
+			for (size_t i = 0; i < 100; i++) {
+				// Alternate between branches so that schemas with several extensions are looked up concurrently.
+				schema = schema->extend("branch" + std::to_string((i + thread) % 2))->extend("concurrentProperty" + std::to_string(i));
+			}
+			schemas[thread] = schema;
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	EXPECT_NE(schemas[0], schemas[1]);
+	for (size_t thread = 0; thread < numThreads; thread++) {
+		EXPECT_EQ(schemas[thread], schemas[thread % 2]);
+		EXPECT_EQ(schemas[thread]->size(), 200);
+	}
+	auto schema = PropertySchema::empty();
+	for (size_t i = 0; i < 100; i++) {
+		schema = schema->extend("branch" + std::to_string(i % 2))->extend("concurrentProperty" + std::to_string(i));
+	}
+	EXPECT_EQ(schema, schemas[0]);
+}
@@ -0,0 +1,263 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "data_storage/BasicAnnotations.h"
+#include "data_storage/Table.h"
+#include "data_storage/Value.h"
+
+#include <utility>
+
+#include "gtest/gtest.h"
+
+using namespace raco::data_storage;
+
+namespace {
+
+// Table with numEntries Double entries and, if withReference is set, a nested Table holding a Ref.
+Table makeTable(int numEntries, bool withReference) {
+	Table table;
+	for (int i = 0; i < numEntries; i++) {
+		table.addProperty("value" + std::to_string(i), PrimitiveType::Double)->set(static_cast<double>(i));
+	}
+	auto& nested = table.addProperty("nested", PrimitiveType::Table)->asTable();
+	nested.addProperty("value", PrimitiveType::Int);
+	if (withReference) {
+		nested.addProperty("ref", PrimitiveType::Ref);
+	}
+	return table;
+}
+
+using ArrayElement = Property<double, RangeAnnotation<double>>;
+
+// Table like the ones holding the elements of Lua arrays: entries named "1", "2", ... of the same Property class.
+Table makeArray(int numElements, double max = 100.0) {
+	Table table;
+	for (int i = 0; i < numElements; i++) {
+		table.addProperty(std::to_string(i + 1), std::make_unique<ArrayElement>(static_cast<double>(i), RangeAnnotation<double>(0.0, max)));
+	}
+	return table;
+}
+
+}  // namespace
+
+TEST(TableTest, copies_share_entries_until_modified) {
+	Table table = makeTable(3, false);
+	Table copy(table);
+	EXPECT_EQ(std::as_const(copy).get(0), std::as_const(table).get(0));
+	EXPECT_EQ(std::as_const(copy).get("nested"), std::as_const(table).get("nested"));
+
+	copy.get("value1")->set(42.0);
+	EXPECT_NE(std::as_const(copy).get(0), std::as_const(table).get(0));
+	EXPECT_EQ(copy.get("value1")->asDouble(), 42.0);
+	EXPECT_EQ(table.get("value1")->asDouble(), 1.0);
+
+	// The nested Table of the modified copy still shares its entries with the original.
+	EXPECT_EQ(std::as_const(copy).get("nested")->asTable().get(0), std::as_const(table).get("nested")->asTable().get(0));
+}
+
+TEST(TableTest, structural_changes_detach) {
+	Table table = makeTable(2, false);
+	Table added(table);
+	Table removed(table);
+	Table renamed(table);
+
+	added.addProperty("extra", PrimitiveType::String);
+	removed.removeProperty("value0");
+	renamed.renameProperty("value1", "renamed");
+
+	EXPECT_EQ(table.propertyNames(), (std::vector<std::string>{"value0", "value1", "nested"}));
+	EXPECT_EQ(added.size(), 4);
+	EXPECT_EQ(removed.propertyNames(), (std::vector<std::string>{"value1", "nested"}));
+	EXPECT_EQ(renamed.index("renamed"), 1);
+	EXPECT_EQ(table.index("renamed"), -1);
+
+	Table cleared(table);
+	cleared.clear();
+	EXPECT_EQ(cleared.size(), 0);
+	EXPECT_EQ(table.size(), 3);
+}
+
+TEST(TableTest, clone_of_value_shares_entries) {
+	Value<Table> value{makeTable(2, false)};
+	auto clone = value.clone(nullptr);
+	EXPECT_EQ(std::as_const(*clone).asTable().get(1), std::as_const(*value).get(1));
+
+	clone->asTable().get(1)->set(5.0);
+	EXPECT_EQ(value->get(1)->asDouble(), 1.0);
+}
+
+TEST(TableTest, contains_references) {
+	EXPECT_FALSE(Table().containsReferences());
+	EXPECT_FALSE(makeTable(2, false).containsReferences());
+
+	Table table = makeTable(2, true);
+	EXPECT_TRUE(table.containsReferences());
+	Table copy(table);
+	EXPECT_TRUE(copy.containsReferences());
+
+	copy.get("nested")->asTable().removeProperty("ref");
+	EXPECT_FALSE(copy.containsReferences());
+	EXPECT_TRUE(table.containsReferences());
+}
+
+TEST(TableTest, translate_only_entries_with_references) {
+	int translations = 0;
+	std::function<SEditorObject(SEditorObject)> translateRef = [&translations](SEditorObject object) {
+		++translations;
+		return object;
+	};
+
+	Table withoutReferences = makeTable(2, false);
+	Table plainCopy(withoutReferences, &translateRef);
+	EXPECT_EQ(translations, 0);
+	EXPECT_EQ(std::as_const(plainCopy).get(0), std::as_const(withoutReferences).get(0));
+
+	Table withReferences = makeTable(2, true);
+	withReferences.addProperty("plain", PrimitiveType::Table)->asTable().addProperty("value", PrimitiveType::Int);
+	Table translatedCopy(withReferences, &translateRef);
+	EXPECT_EQ(translations, 1);
+	EXPECT_EQ(translatedCopy.propertyNames(), withReferences.propertyNames());
+	// Nested Tables without references still share their entries.
+	EXPECT_EQ(std::as_const(translatedCopy).get("plain")->asTable().get(0), std::as_const(withReferences).get("plain")->asTable().get(0));
+	EXPECT_NE(std::as_const(translatedCopy).get("nested")->asTable().get(0), std::as_const(withReferences).get("nested")->asTable().get(0));
+}
+
+TEST(TableTest, dense_entries) {
+	Table table = makeArray(256);
+	ASSERT_FALSE(table.isDense());
+	ASSERT_TRUE(table.makeDense());
+	ASSERT_TRUE(table.isDense());
+	EXPECT_EQ(table.size(), 256);
+	EXPECT_EQ(table.name(3), "4");
+	EXPECT_EQ(table.index("256"), 255);
+
+	const double* values = std::as_const(table).denseData<double>();
+	ASSERT_NE(values, nullptr);
+	EXPECT_EQ(std::as_const(table).denseData<int>(), nullptr);
+	for (size_t i = 0; i < table.size(); i++) {
+		ASSERT_EQ(&std::as_const(table).get(i)->asDouble(), values + i);
+	}
+
+	ValueBase* entry = table.get("10");
+	EXPECT_EQ(entry->type(), PrimitiveType::Double);
+	EXPECT_EQ(entry->typeName(), ArrayElement().typeName());
+	EXPECT_EQ(entry->query<RangeAnnotation<double>>()->getMax(), 100.0);
+	EXPECT_THROW(entry->asInt(), std::runtime_error);
+	EXPECT_TRUE(ValueBase::classesEqual(*entry, *table.get(0)));
+	EXPECT_FALSE(ValueBase::classesEqual(*entry, ArrayElement()));
+
+	*entry = 42.0;
+	EXPECT_EQ(table.denseData<double>()[9], 42.0);
+	table.denseData<double>()[9] = 43.0;
+	EXPECT_EQ(table.get("10")->asDouble(), 43.0);
+
+	auto clone = table.get("10")->clone(nullptr);
+	EXPECT_TRUE(ValueBase::classesEqual(*clone, ArrayElement()));
+	EXPECT_EQ(clone->asDouble(), 43.0);
+	EXPECT_EQ(clone->query<RangeAnnotation<double>>()->getMax(), 100.0);
+}
+
+TEST(TableTest, dense_requires_uniform_entries) {
+	EXPECT_FALSE(Table().makeDense());
+	EXPECT_FALSE(makeTable(2, false).makeDense());
+
+	Table differentAnnotations = makeArray(3);
+	differentAnnotations.addProperty("4", std::make_unique<ArrayElement>(0.0, RangeAnnotation<double>(0.0, 1.0)));
+	EXPECT_FALSE(differentAnnotations.makeDense());
+
+	Table differentClasses = makeArray(3);
+	differentClasses.addProperty("4", PrimitiveType::Double);
+	EXPECT_FALSE(differentClasses.makeDense());
+}
+
+TEST(TableTest, dense_structural_changes) {
+	Table table = makeArray(4);
+	ASSERT_TRUE(table.makeDense());
+
+	table.addProperty("new", std::make_unique<ArrayElement>(7.0, RangeAnnotation<double>(0.0, 100.0)), 1);
+	table.removeProperty("3");
+	table.renameProperty("4", "renamed");
+	table.replaceProperty(0, new ArrayElement(-1.0, RangeAnnotation<double>(0.0, 100.0)));
+	EXPECT_TRUE(table.isDense());
+	EXPECT_EQ(table.propertyNames(), (std::vector<std::string>{"1", "new", "2", "renamed"}));
+	EXPECT_EQ(table.asVector<double>(), (std::vector<double>{-1.0, 7.0, 1.0, 3.0}));
+
+	// Entries of other classes turn the Table back into separately allocated entries.
+	table.addProperty("plain", PrimitiveType::Double)->set(5.0);
+	EXPECT_FALSE(table.isDense());
+	EXPECT_EQ(table.asVector<double>(), (std::vector<double>{-1.0, 7.0, 1.0, 3.0, 5.0}));
+	EXPECT_TRUE(ValueBase::classesEqual(*table.get(0), ArrayElement()));
+	EXPECT_EQ(table.get("renamed")->query<RangeAnnotation<double>>()->getMax(), 100.0);
+}
+
+TEST(TableTest, dense_copies_share_values_until_modified) {
+	Table table = makeArray(8);
+	ASSERT_TRUE(table.makeDense());
+	Table copy(table);
+	EXPECT_TRUE(copy.isDense());
+	EXPECT_EQ(std::as_const(copy).denseData<double>(), std::as_const(table).denseData<double>());
+
+	copy.denseData<double>()[2] = 42.0;
+	EXPECT_NE(std::as_const(copy).denseData<double>(), std::as_const(table).denseData<double>());
+	EXPECT_EQ(table.get(2)->asDouble(), 2.0);
+	EXPECT_EQ(copy.get(2)->asDouble(), 42.0);
+}
+
+TEST(TableTest, assign_dense) {
+	Table table = makeArray(8);
+	Table other = makeArray(8);
+	std::vector<size_t> changed;
+	EXPECT_FALSE(table.assignDense(other, changed));
+
+	ASSERT_TRUE(table.makeDense());
+	ASSERT_TRUE(other.makeDense());
+	EXPECT_TRUE(table.assignDense(other, changed));
+	EXPECT_TRUE(changed.empty());
+
+	other.get(3)->set(-3.0);
+	other.get(5)->set(-5.0);
+	EXPECT_TRUE(table.assignDense(other, changed));
+	EXPECT_EQ(changed, (std::vector<size_t>{3, 5}));
+	EXPECT_EQ(table.asVector<double>(), other.asVector<double>());
+
+	other.renameProperty("1", "first");
+	EXPECT_FALSE(table.assignDense(other, changed));
+	EXPECT_EQ(table.name(0), "1");
+}
+
+TEST(TableTest, dense_update_from_modified_copy) {
+	constexpr int numElements = 256;
+	Table table = makeArray(numElements);
+	ASSERT_TRUE(table.makeDense());
+
+	// Modify a copy, e.g. of an undo stack snapshot, and update the original from it like the undo stack does.
+	for (int i = 0; i < 2 * numElements; i += 37) {
+		Table copy(table);
+		copy.get(i % numElements)->set(static_cast<double>(-1 - i));
+		std::vector<size_t> changed;
+		ASSERT_TRUE(table.assignDense(copy, changed));
+		EXPECT_EQ(changed, std::vector<size_t>{static_cast<size_t>(i % numElements)});
+		EXPECT_EQ(table.get(i % numElements)->asDouble(), static_cast<double>(-1 - i));
+		EXPECT_TRUE(table.isDense());
+	}
+}
+
+TEST(TableTest, clone_of_large_table_shares_entries) {
+	constexpr int numEntries = 10000;
+	Value<Table> value{makeTable(numEntries, false)};
+	auto clone = value.clone(nullptr);
+	for (int index : {0, numEntries / 2, numEntries - 1, numEntries}) {
+		EXPECT_EQ(std::as_const(*clone).asTable().get(index), std::as_const(*value).get(index));
+	}
+
+	clone->asTable().get(0)->set(-1.0);
+	EXPECT_NE(std::as_const(*clone).asTable().get(0), std::as_const(*value).get(0));
+	EXPECT_EQ(value->get(0)->asDouble(), 0.0);
+	EXPECT_EQ(clone->asTable().get(0)->asDouble(), -1.0);
+}
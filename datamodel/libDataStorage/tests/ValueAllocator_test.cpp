@@ -0,0 +1,93 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/GENIVI/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "data_storage/BasicAnnotations.h"
+#include "data_storage/BasicTypes.h"
+#include "data_storage/Table.h"
+#include "data_storage/Value.h"
+#include "data_storage/ValueAllocator.h"
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace raco::data_storage;
+
+namespace {
+
+using RangedDouble = Property<double, DisplayNameAnnotation, RangeAnnotation<double>>;
+
+// A Table shaped like the inputs of a typical Lua script.
+void fillTable(Table& table) {
+	for (int i = 0; i < 4; i++) {
+		table.addProperty("double" + std::to_string(i), PrimitiveType::Double);
+		table.addProperty("vector" + std::to_string(i), PrimitiveType::Vec3f);
+		table.addProperty("ranged" + std::to_string(i), std::make_unique<RangedDouble>(0.0, DisplayNameAnnotation("Ranged"), RangeAnnotation<double>(-1.0, 1.0)));
+	}
+	auto nested = table.addProperty("struct", PrimitiveType::Table);
+	nested->asTable().addProperty("flag", PrimitiveType::Bool);
+	nested->asTable().addProperty("name", PrimitiveType::String);
+}
+
+}  // namespace
+
+TEST(ValueAllocatorTest, counts_allocations) {
+	auto before = ValueAllocator::statistics();
+	{
+		Table table;
+		fillTable(table);
+		auto during = ValueAllocator::statistics();
+		// 12 scalar and vector entries, the nested Table and its 2 entries
+		EXPECT_EQ(during.allocations - before.allocations, 15u);
+		EXPECT_EQ(during.liveObjects() - before.liveObjects(), 15u);
+		EXPECT_GT(during.slabs, 0u);
+		EXPECT_EQ(during.slabBytes, during.slabs * ValueAllocator::SLAB_SIZE);
+	}
+	auto after = ValueAllocator::statistics();
+	EXPECT_EQ(after.liveObjects(), before.liveObjects());
+	EXPECT_EQ(after.deallocations - before.deallocations, 15u);
+}
+
+TEST(ValueAllocatorTest, reuses_freed_blocks) {
+	auto first = std::make_unique<Value<double>>(1.0);
+	ValueBase* address = first.get();
+	first.reset();
+	auto second = std::make_unique<Value<double>>(2.0);
+	EXPECT_EQ(second.get(), address);
+	EXPECT_EQ(**second, 2.0);
+}
+
+TEST(ValueAllocatorTest, free_on_other_thread) {
+	std::vector<std::unique_ptr<Table>> tables(100);
+	auto before = ValueAllocator::statistics();
+	std::thread producer([&tables]() {
+		for (auto& table : tables) {
+			table = std::make_unique<Table>();
+			fillTable(*table);
+		}
+	});
+	producer.join();
+	EXPECT_EQ(ValueAllocator::statistics().liveObjects() - before.liveObjects(), 15u * tables.size());
+	tables.clear();
+	EXPECT_EQ(ValueAllocator::statistics().liveObjects(), before.liveObjects());
+}
+
+TEST(ValueAllocatorTest, large_objects) {
+	struct Large : public Value<double> {
+		char payload[2 * ValueAllocator::MAX_SLAB_OBJECT_SIZE];
+	};
+	auto before = ValueAllocator::statistics();
+	std::unique_ptr<ValueBase> large = std::make_unique<Large>();
+	EXPECT_EQ(ValueAllocator::statistics().largeAllocations - before.largeAllocations, 1u);
+	large.reset();
+	EXPECT_EQ(ValueAllocator::statistics().liveObjects(), before.liveObjects());
+}
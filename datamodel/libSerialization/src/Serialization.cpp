@@ -105,13 +105,15 @@ void deserializeObjectProperties(const QJsonObject& properties, ReflectionInterf
 void deserializeArrayProperties(const QJsonArray& properties, ReflectionInterface& arrayInterface, References& references, const DeserializationFactory& factory, bool dynamicallyType);
 
 /** Deserializes result of `serializeAnnotations` from `annotations` into the annotations of the given `value`. */
-void deserializeAnnotations(const QJsonArray& annotations, const ValueBase& value, References& references, const DeserializationFactory& factory) {
+void deserializeAnnotations(const QJsonArray& annotations, ValueBase& value, References& references, const DeserializationFactory& factory) {
+	const auto& annotationPtrs{value.modifiableAnnotationPtrs()};
 	for (const auto& annotation : annotations) {
-		auto it = std::find_if(value.baseAnnotationPtrs().begin(), value.baseAnnotationPtrs().end(), [&annotation](const raco::data_storage::AnnotationBase* annoBase) {
+		auto it = std::find_if(annotationPtrs.begin(), annotationPtrs.end(), [&annotation](const raco::data_storage::AnnotationBase* annoBase) {
 			return annoBase->getTypeDescription().typeName == annotation[keys::TYPENAME].toString().toStdString();
 		});
 		deserializeObjectProperties(annotation[keys::PROPERTIES].toObject(), **it, references, factory, false);
 	}
+	value.annotationsModified();
 }
 
 std::optional<QJsonArray> serializeObjectAnnotations(const ClassWithReflectedMembers* object, const ResolveReferencedId& resolveReferenceId) {
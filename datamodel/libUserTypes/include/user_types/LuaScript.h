@@ -43,6 +43,11 @@ public:
 
 	void onAfterContextActivated(BaseContext& context) override;
 	void onAfterValueChanged(BaseContext& context, ValueHandle const& value) override;
+
+	// Script source read by the last interface sync; used by the engine adaptor to avoid reading the file again.
+	const std::string& currentScriptContents() const {
+		return currentScriptContents_;
+	}
 	
 	Property<std::string, URIAnnotation, DisplayNameAnnotation> uri_{std::string{}, {"Lua script files(*.lua)"}, DisplayNameAnnotation("URI")};
 
@@ -55,6 +60,7 @@ private:
 
 	mutable FileChangeMonitor::UniqueListener uriListener_;
 	OutdatedPropertiesStore cachedLuaInputValues_;
+	std::string currentScriptContents_;
 
 };
 
@@ -25,7 +25,7 @@ public:
 		return typeDescription;
 	}
 
-	Mesh(Mesh const& other) : BaseObject(other), uri_(other.uri_), meshIndex_(other.meshIndex_), bakeMeshes_(other.bakeMeshes_), materialNames_(other.materialNames_)
+	Mesh(Mesh const& other) : BaseObject(other), uri_(other.uri_), meshIndex_(other.meshIndex_), bakeMeshes_(other.bakeMeshes_), optimizeMesh_(other.optimizeMesh_), lodLevel_(other.lodLevel_), quantizeAttributes_(other.quantizeAttributes_), materialNames_(other.materialNames_)
 	{
 		fillPropertyDescription();
 	}
@@ -39,6 +39,9 @@ public:
 		properties_.emplace_back("uri", &uri_);
 		properties_.emplace_back("meshIndex", &meshIndex_);
 		properties_.emplace_back("bakeMeshes", &bakeMeshes_);
+		properties_.emplace_back("optimizeMesh", &optimizeMesh_);
+		properties_.emplace_back("lodLevel", &lodLevel_);
+		properties_.emplace_back("quantizeAttributes", &quantizeAttributes_);
 		properties_.emplace_back("materialNames", &materialNames_);
 	}
 
@@ -53,6 +56,9 @@ public:
 
 	Property<int, DisplayNameAnnotation> meshIndex_{0, DisplayNameAnnotation("Mesh Index")};
 	Property<bool, DisplayNameAnnotation> bakeMeshes_{true, DisplayNameAnnotation("Bake All Meshes")};
+	Property<bool, DisplayNameAnnotation> optimizeMesh_{false, DisplayNameAnnotation("Optimize Mesh")};
+	Property<int, RangeAnnotation<int>, DisplayNameAnnotation> lodLevel_{0, {0, 4}, DisplayNameAnnotation("LOD Level")};
+	Property<bool, DisplayNameAnnotation> quantizeAttributes_{false, DisplayNameAnnotation("Quantize Attributes")};
 	
 	Property<Table, ArraySemanticAnnotation, HiddenProperty> materialNames_{{}, {}, {}};
 	
@@ -60,12 +66,20 @@ public:
 		return mesh_;
 	}
 
+	// True while an asynchronous load of the mesh is pending; meshData() is empty until the load completes.
+	bool isLoading() const {
+		return loading_;
+	}
+
 private:
 	void updateMesh(BaseContext& context);
+	void onMeshLoaded(BaseContext& context, const MeshDescriptor& desc);
 	
 	SharedMeshData mesh_;
+	bool loading_{false};
 
 	mutable FileChangeMonitor::UniqueListener uriListener_;
+	mutable MeshCache::LoadHandle loadHandle_{nullptr, [](void*) {}};
 };
 
 using SMesh = std::shared_ptr<Mesh>;
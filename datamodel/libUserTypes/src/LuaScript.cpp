@@ -37,12 +37,12 @@ void LuaScript::onAfterValueChanged(BaseContext& context, ValueHandle const& val
 }
 
 void LuaScript::syncLuaInterface(BaseContext& context) {
-	std::string luaScript = utils::file::read(PathQueries::resolveUriPropertyToAbsolutePath(*context.project(), {shared_from_this(), {"uri"}}));
+	currentScriptContents_ = utils::file::read(PathQueries::resolveUriPropertyToAbsolutePath(*context.project(), {shared_from_this(), {"uri"}}));
 	PropertyInterfaceList inputs{};
 	PropertyInterfaceList outputs{};
 	std::string error{};
-	if (!luaScript.empty())
-		context.engineInterface().parseLuaScript(luaScript, inputs, outputs, error);
+	if (!currentScriptContents_.empty())
+		context.engineInterface().parseLuaScript(currentScriptContents_, inputs, outputs, error);
 
 	context.errors().removeError({shared_from_this()});
 	if (validateURI(context, {shared_from_this(), {"uri"}})) {
@@ -21,6 +21,7 @@ namespace raco::user_types {
 void Mesh::onBeforeDeleteObject(Errors& errors) const {
 	EditorObject::onBeforeDeleteObject(errors);
 	uriListener_.reset();
+	loadHandle_.reset();
 }
 
 void Mesh::onAfterContextActivated(BaseContext& context) {
@@ -37,19 +38,54 @@ void Mesh::updateMesh(BaseContext& context) {
 	desc.absPath = PathQueries::resolveUriPropertyToAbsolutePath(*context.project(), {shared_from_this(), {"uri"}});
 	desc.bakeAllSubmeshes = bakeMeshes_.asBool();
 	desc.submeshIndex = meshIndex_.asInt();
+	desc.optimizeMesh = optimizeMesh_.asBool();
+	desc.lodLevel = lodLevel_.asInt();
+	desc.quantizeAttributes = quantizeAttributes_.asBool();
 
 	if (validateURI(context, {shared_from_this(), {"uri"}})) {
-		mesh_ = context.meshCache()->loadMesh(desc);
-		if (!mesh_) {
-			auto savedErrorString = context.meshCache()->getMeshError(desc.absPath);
-			auto errorMessage = (savedErrorString.empty()) ? "Invalid mesh file." : "Error while importing mesh: " + savedErrorString;
-			context.errors().addError(ErrorCategory::PARSE_ERROR, ErrorLevel::ERROR, {shared_from_this()}, errorMessage);
+		// The material names don't depend on the mesh data, so they are set here and not by the possibly deferred load completion
+		// which runs outside of any command.
+		ValueHandle matnames_handle{shared_from_this(), {"materialNames"}};
+		std::vector<std::string> materialNames{"material"};
+		if (materialNames_->asVector<std::string>() != materialNames) {
+			context.set(matnames_handle, materialNames);
+		}
+
+		loading_ = true;
+		// Replacing the handle cancels a pending load for outdated mesh property values.
+		// The handle is reset in onBeforeDeleteObject which is also called for all objects before their context is destroyed,
+		// so the context outlives the callback.
+		std::weak_ptr<EditorObject> weakThis = shared_from_this();
+		loadHandle_ = context.meshCache()->loadMeshAsync(desc, [weakThis, &context, desc](SharedMeshData mesh) {
+			if (auto self = std::static_pointer_cast<Mesh>(weakThis.lock())) {
+				self->loading_ = false;
+				self->mesh_ = mesh;
+				self->onMeshLoaded(context, desc);
+			}
+		});
+		if (loading_) {
+			mesh_.reset();
+			context.errors().addError(ErrorCategory::GENERAL, ErrorLevel::INFORMATION, ValueHandle{shared_from_this()}, "Loading mesh...");
+			context.changeMultiplexer().recordPreviewDirty(shared_from_this());
 		}
 	} else {
+		loadHandle_.reset();
+		loading_ = false;
 		mesh_.reset();
+		context.changeMultiplexer().recordPreviewDirty(shared_from_this());
 	}
+}
 
-	if (mesh_) {
+void Mesh::onMeshLoaded(BaseContext& context, const MeshDescriptor& desc) {
+	// Only errors and the preview are updated since the load may complete outside of a command:
+	// neither is part of the data model, so the undo stack and the project dirty state are not affected.
+	context.errors().removeError(ValueHandle{shared_from_this()});
+
+	if (!mesh_) {
+		auto savedErrorString = context.meshCache()->getMeshError(desc.absPath);
+		auto errorMessage = (savedErrorString.empty()) ? "Invalid mesh file." : "Error while importing mesh: " + savedErrorString;
+		context.errors().addError(ErrorCategory::PARSE_ERROR, ErrorLevel::ERROR, {shared_from_this()}, errorMessage);
+	} else {
 		std::string infoText;
 		auto selectedMesh = mesh_.get();
 
@@ -63,6 +99,12 @@ void Mesh::updateMesh(BaseContext& context) {
 		infoText += "Mesh information\n\n";
 
 		infoText += fmt::format("Triangles: {}\n", selectedMesh->numTriangles());
+		if (desc.lodLevel > 0) {
+			// The simplification may stop short of its target, so report the triangles actually left.
+			auto fullDetailTriangles = selectedMesh->numFullDetailTriangles();
+			infoText += fmt::format("LOD Level: {} ({} of {} full detail triangles, {:.0f}%)\n", desc.lodLevel, selectedMesh->numTriangles(), fullDetailTriangles,
+				fullDetailTriangles > 0 ? 100.0 * selectedMesh->numTriangles() / fullDetailTriangles : 100.0);
+		}
 		infoText += fmt::format("Vertices: {}\n", selectedMesh->numVertices());
 		//infoText += fmt::format("Submeshes: {}\n", selectedMesh->numSubmeshes());
 		infoText += fmt::format("Total Asset File Meshes: {}\n", context.meshCache()->getTotalMeshCount(desc.absPath, desc.bakeAllSubmeshes));
@@ -74,12 +116,9 @@ void Mesh::updateMesh(BaseContext& context) {
 		if (!infoText.empty()) {
 			context.errors().addError(ErrorCategory::GENERAL, ErrorLevel::INFORMATION, ValueHandle{shared_from_this()}, infoText);
 		}
-
-		ValueHandle matnames_handle{shared_from_this(), {"materialNames"}};
-		context.set(matnames_handle, std::vector<std::string>{"material"});
 	}
 
-	context.changeMultiplexer().recordPreviewDirty(shared_from_this());
+	context.uiChanges().recordPreviewDirty(shared_from_this());
 }
 
 std::vector<std::string> Mesh::materialNames() {
@@ -90,12 +129,15 @@ void Mesh::onAfterValueChanged(BaseContext& context, ValueHandle const& value) {
 	ValueHandle uriHandle(shared_from_this(), {"uri"});
 	ValueHandle submeshIndexHandle(shared_from_this(), {"meshIndex"});
 	ValueHandle bakeMeshesHandle(shared_from_this(), {"bakeMeshes"});
+	ValueHandle optimizeMeshHandle(shared_from_this(), {"optimizeMesh"});
+	ValueHandle lodLevelHandle(shared_from_this(), {"lodLevel"});
+	ValueHandle quantizeAttributesHandle(shared_from_this(), {"quantizeAttributes"});
 	if (value == uriHandle) {
 		auto uriAbsPath = PathQueries::resolveUriPropertyToAbsolutePath(*context.project(), {shared_from_this(), {"uri"}});
 		uriListener_ = context.meshCache()->registerFileChangedHandler(uriAbsPath, {&context, shared_from_this(),
 			[this, &context]() { updateMesh(context); }});
 		updateMesh(context);
-	} else if (value == bakeMeshesHandle || !bakeMeshes_.asBool() && value == submeshIndexHandle) {
+	} else if (value == bakeMeshesHandle || value == optimizeMeshHandle || value == lodLevelHandle || value == quantizeAttributesHandle || !bakeMeshes_.asBool() && value == submeshIndexHandle) {
 		context.changeMultiplexer().recordPreviewDirty(shared_from_this());
 		updateMesh(context);
 	}
@@ -186,6 +186,9 @@ inline void addProperties(raco::core::BaseContext& context, const PropertyInterf
 		}
 		if (iEntry.primitiveType() == PrimitiveType::Table) {
 			addProperties(context, iEntry.children, property.get(name), propertyPath + propertyPathSeparator + name, outdatedPropertiesStore, linkStart, linkEnd);
+			if (iEntry.type == EnginePrimitive::Array) {
+				context.makeTableDense(property.get(name));
+			}
 		}
 	}
 }
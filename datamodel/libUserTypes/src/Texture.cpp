@@ -45,7 +45,10 @@ void Texture::onAfterValueChanged(BaseContext& context, ValueHandle const& value
 				context.changeMultiplexer().recordPreviewDirty(shared_from_this());
 			});
 	}
-	context.changeMultiplexer().recordPreviewDirty(shared_from_this());
+	// Only changes of the image content need to reload the texture; the sampler properties are handled by the adaptor directly.
+	if (uriHandle == value || ValueHandle{shared_from_this(), {"origin"}} == value) {
+		context.changeMultiplexer().recordPreviewDirty(shared_from_this());
+	}
 }
 
 }  // namespace raco::user_types
@@ -154,6 +154,37 @@ end
 	EXPECT_EQ(script->luaInputs_->get("float_array")->asTable().propertyNames(), std::vector<std::string>({"1", "2", "3"}));
 }
 
+TEST_F(LuaScriptTest, float_array_stored_densely) {
+	auto script = create<LuaScript>("script");
+	TextFile scriptFile = makeFile("script.lua", R"(
+function interface()
+	IN.float_array = ARRAY(256, FLOAT)
+	IN.vector_array = ARRAY(4, VEC3F)
+end
+
+function run()
+end
+)");
+	commandInterface.set({script, {"uri"}}, scriptFile);
+
+	const Table& floatArray = script->luaInputs_->get("float_array")->asTable();
+	ASSERT_TRUE(floatArray.isDense());
+	EXPECT_EQ(floatArray.size(), 256);
+	EXPECT_EQ(floatArray.name(16), "17");
+	EXPECT_FALSE(script->luaInputs_->get("vector_array")->asTable().isDense());
+
+	ValueHandle element{script, {"luaInputs", "float_array", "17"}};
+	EXPECT_EQ(element.type(), PrimitiveType::Double);
+	commandInterface.set(element, 3.0);
+	EXPECT_EQ(floatArray.denseData<double>()[16], 3.0);
+
+	undoStack.undo();
+	EXPECT_EQ(element.asDouble(), 0.0);
+	undoStack.redo();
+	EXPECT_EQ(element.asDouble(), 3.0);
+	EXPECT_TRUE(floatArray.isDense());
+}
+
 TEST_F(LuaScriptTest, outArrayOfStructs) {
 	auto script{commandInterface.createObject(LuaScript::typeDescription.typeName)};
 	ValueHandle s{script};